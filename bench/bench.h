@@ -0,0 +1,48 @@
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+// Минимальный каркас для бенчмарков
+// Каждый бенчмарк регистрируется макросом BENCHMARK_CASE и запускается из bench_main.cpp
+
+using BenchmarkFunction = void (*)();
+
+// Описание зарегистрированного бенчмарка
+struct Benchmark {
+    std::string name;
+    BenchmarkFunction function;
+};
+
+// Список всех бенчмарков программы
+std::vector<Benchmark>& benchmarks();
+
+// Вспомогательный объект для регистрации бенчмарка при статической инициализации
+struct BenchmarkRegistrar {
+    BenchmarkRegistrar(const std::string& name, BenchmarkFunction function) {
+        benchmarks().push_back({name, function});
+    }
+};
+
+#define BENCHMARK_CASE(name) \
+    static void name(); \
+    static BenchmarkRegistrar name##_registrar(#name, name); \
+    static void name()
+
+// Секундомер для измерения времени участков кода
+class Stopwatch {
+private:
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+public:
+    void reset() { start = std::chrono::steady_clock::now(); }
+
+    double elapsed_ms() const {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    double elapsed_ns() const {
+        return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    }
+};
@@ -0,0 +1,92 @@
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+#include "bench.h"
+#include "board.h"
+#include "column.h"
+#include "developer.h"
+#include "task.h"
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+namespace {
+
+// Байты кучи, занятые программой (0 если платформа не сообщает)
+std::size_t heap_in_use() {
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+    struct mallinfo2 info = mallinfo2();
+    return info.uordblks + info.hblkhd;  // Занятые блоки и крупные блоки через mmap
+#else
+    return 0;
+#endif
+}
+
+// Построение доски тем же набором операций, что и board_load
+void populate(Board& board, int developer_count, int task_count) {
+    board.clear_columns();
+    board.clear_developers();
+    Task::clear_used_ids();
+    board.release_arena();
+    ArenaScope scope(board.get_arena());
+
+    for (int d = 0; d < developer_count; ++d) {
+        board.add_developer(std::make_unique<Developer>("Developer #" + std::to_string(d)));
+    }
+    const char* names[] = {"Backlog", "Assigned", "In Progress", "Blocked", "Done"};
+    std::vector<std::unique_ptr<Column>> columns;
+    for (const char* name : names) {
+        columns.push_back(std::make_unique<Column>(name));
+    }
+    const auto& developers = board.get_developers();
+    for (int i = 0; i < task_count; ++i) {
+        auto task = std::make_unique<Task>("Task title number " + std::to_string(i));
+        task->set_description("Description of the task number " + std::to_string(i));
+        task->set_priority(i % 11);
+        task->set_developer(developers[i % developer_count].get());
+        columns[i % columns.size()]->add_task(std::move(task));
+    }
+    for (auto& column : columns) {
+        board.add_column(std::move(column));
+    }
+}
+
+void run(bool use_arena) {
+    const int developer_count = 1000;
+    const int task_count = 1000000;
+
+    Board board("Bench Board");
+    if (use_arena) {
+        board.enable_arena();
+    }
+
+    std::size_t heap_before = heap_in_use();
+    Stopwatch watch;
+    populate(board, developer_count, task_count);
+    double load_ms = watch.elapsed_ms();
+    std::size_t heap_after = heap_in_use();
+    std::size_t arena_bytes = use_arena ? board.get_arena()->get_reserved_bytes() : 0;
+
+    watch.reset();
+    board.clear_columns();
+    board.clear_developers();
+    board.release_arena();
+    double clear_ms = watch.elapsed_ms();
+
+    std::cout << std::left << std::setw(6) << (use_arena ? "arena" : "heap") << std::right
+              << " load " << std::fixed << std::setprecision(1) << std::setw(8) << load_ms << " ms"
+              << "  clear " << std::setw(8) << clear_ms << " ms"
+              << "  memory " << std::setw(8) << (heap_after - heap_before) / (1024.0 * 1024.0) << " MiB"
+              << " (arena blocks " << arena_bytes / (1024.0 * 1024.0) << " MiB)" << std::endl;
+}
+
+} // namespace
+
+// Загрузка 1M задач в куче и в арене доски: время загрузки, очистки и занятая память
+// В памяти арены учтены и блоки арены, и индексы доски, которые остаются в куче
+BENCHMARK_CASE(ArenaVersusHeapLoad) {
+    run(false);
+    run(true);
+}
@@ -0,0 +1,63 @@
+#include <cstdio>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+#include "autosave_service.h"
+#include "bench.h"
+#include "board.h"
+#include "column.h"
+#include "developer.h"
+#include "json_worker.h"
+#include "task.h"
+
+// Время, на которое сохранение останавливает поток доски (UI):
+// синхронное board_save против снятия снимка для фонового автосохранения
+BENCHMARK_CASE(AutosaveBoardThreadLatency) {
+    const std::string path = "bench_autosave.json";
+    for (int task_count : {10000, 100000, 1000000}) {
+        Board board("Bench Board");
+        const char* names[] = {"Backlog", "Assigned", "In Progress", "Blocked", "Done"};
+        std::vector<Column*> columns;
+        for (const char* name : names) {
+            board.add_column(std::make_unique<Column>(name));
+            columns.push_back(board.find_column(name));
+        }
+        for (int d = 0; d < 100; ++d) {
+            board.add_developer(std::make_unique<Developer>("Developer #" + std::to_string(d)));
+        }
+        const auto& developers = board.get_developers();
+        for (int i = 0; i < task_count; ++i) {
+            auto task = std::make_unique<Task>("Task title number " + std::to_string(i));
+            task->set_description("Description of the task number " + std::to_string(i));
+            task->set_priority(i % 11);
+            task->set_developer(developers[i % developers.size()].get());
+            columns[i % columns.size()]->add_task(std::move(task));
+        }
+
+        Stopwatch watch;
+        Json_worker(path).board_save(board);
+        double sync_ms = watch.elapsed_ms();
+
+        AutosaveService autosave(board, path, std::chrono::hours(1));
+        Task* task = columns[0]->get_tasks().front().get();
+        watch.reset();
+        const int changes = 10000;
+        for (int i = 0; i < changes; ++i) {
+            task->set_priority(i % 11);
+        }
+        double change_ns = watch.elapsed_ns() / changes;
+
+        watch.reset();
+        autosave.save_now();
+        double capture_ms = watch.elapsed_ms();
+        autosave.flush();
+        double total_ms = watch.elapsed_ms();
+
+        std::cout << std::setw(8) << task_count << " tasks: sync save " << std::fixed << std::setprecision(1)
+                  << sync_ms << " ms on board thread; autosave " << capture_ms << " ms on board thread, "
+                  << total_ms << " ms until written; " << change_ns << " ns per tracked change" << std::endl;
+    }
+    std::remove(path.c_str());
+}
@@ -0,0 +1,101 @@
+#include <cstdio>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+#include "bench.h"
+#include "binary_worker.h"
+#include "board.h"
+#include "column.h"
+#include "developer.h"
+#include "json_worker.h"
+#include "task.h"
+
+// Открытие доски на 1M задач: JSON против двоичного снимка
+// Отдельно меряется открытие представления - чтение без построения модели
+// Цель "меньше секунды" относится к представлению; загрузка в Board включает
+// регистрацию ID и индексы доски (см. binary_worker.h)
+BENCHMARK_CASE(BinaryVersusJsonLoad) {
+    const int task_count = 1000000;
+    const std::string json_path = "bench_binary.json";
+    const std::string binary_path = "bench_binary.tsb";
+    {
+        Board board("Bench Board");
+        const char* names[] = {"Backlog", "Assigned", "In Progress", "Blocked", "Done"};
+        std::vector<Column*> columns;
+        for (const char* name : names) {
+            board.add_column(std::make_unique<Column>(name));
+            columns.push_back(board.find_column(name));
+        }
+        for (int d = 0; d < 100; ++d) {
+            board.add_developer(std::make_unique<Developer>("Developer #" + std::to_string(d)));
+        }
+        const auto& developers = board.get_developers();
+        for (int i = 0; i < task_count; ++i) {
+            auto task = std::make_unique<Task>("Task title number " + std::to_string(i));
+            task->set_description("Description of the task number " + std::to_string(i));
+            task->set_priority(i % 11);
+            task->set_developer(developers[i % developers.size()].get());
+            columns[i % columns.size()]->add_task(std::move(task));
+        }
+        Json_worker(json_path).board_save(board);
+        Stopwatch watch;
+        Binary_worker(binary_path).board_save(board);
+        std::cout << "binary save: " << std::fixed << std::setprecision(1) << watch.elapsed_ms() << " ms" << std::endl;
+    }
+
+    for (bool arena : {false, true}) {
+        Board json_board("Loaded");
+        Board binary_board("Loaded");
+        if (arena) {
+            json_board.enable_arena();
+            binary_board.enable_arena();
+        }
+        Stopwatch watch;
+        Json_worker(json_path).board_load(json_board);
+        double json_ms = watch.elapsed_ms();
+        watch.reset();
+        Binary_worker(binary_path).board_load(binary_board);
+        double binary_ms = watch.elapsed_ms();
+        std::cout << (arena ? "arena" : "heap") << ": json load " << json_ms << " ms, binary load "
+                  << binary_ms << " ms (" << task_count << " tasks)" << std::endl;
+    }
+
+    // Ленивые описания: в модель попадает все, кроме описаний
+    for (bool lazy : {false, true}) {
+        Board board("Loaded");
+        board.enable_arena();
+        Binary_worker reader(binary_path);
+        reader.set_lazy_descriptions(lazy);
+        Stopwatch watch;
+        reader.board_load(board);
+        double load_ms = watch.elapsed_ms();
+        std::size_t on_disk = 0;
+        for (const auto& column : board.get_columns()) {
+            for (const auto& task : column->get_tasks()) {
+                if (task->has_lazy_description()) {
+                    on_disk += task->get_description().size();
+                }
+            }
+        }
+        std::cout << (lazy ? "lazy" : "eager") << " descriptions: load " << load_ms << " ms, "
+                  << on_disk / 1024 << " KiB of descriptions left in the file, arena "
+                  << board.get_arena()->get_reserved_bytes() / (1024 * 1024) << " MiB" << std::endl;
+    }
+
+    Stopwatch watch;
+    std::size_t characters = 0;
+    {
+        BinaryBoardView view(binary_path);
+        for (std::size_t t = 0; t < view.task_count(); ++t) {
+            characters += view.task_title(t).size();
+        }
+    }
+    double view_ms = watch.elapsed_ms();
+    std::cout << "binary view open + scan titles: " << view_ms << " ms (" << characters
+              << " characters), target < 1000 ms: " << (view_ms < 1000 ? "met" : "missed") << std::endl;
+
+    std::remove(json_path.c_str());
+    std::remove(binary_path.c_str());
+}
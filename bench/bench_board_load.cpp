@@ -0,0 +1,168 @@
+#include <algorithm>
+#include <cstdio>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+#include <rapidjson/filereadstream.h>
+#include <rapidjson/reader.h>
+#include "bench.h"
+#include "board.h"
+#include "column.h"
+#include "developer.h"
+#include "json_worker.h"
+#include "task.h"
+
+// Загрузка синтетической доски: 10k разработчиков и 1M задач
+// board_load ищет разработчика по имени для каждой задачи, поэтому
+// без индекса имен загрузка стоит O(задачи × разработчики)
+BENCHMARK_CASE(BoardLoadManyDevelopers) {
+    const int developer_count = 10000;
+    const int task_count = 1000000;
+    const std::string path = "bench_board_load.json";
+
+    // Строим и сохраняем доску
+    {
+        Board board("Bench Board");
+        const char* names[] = {"Backlog", "Assigned", "In Progress", "Blocked", "Done"};
+        std::vector<Column*> columns;
+        for (const char* name : names) {
+            board.add_column(std::make_unique<Column>(name));
+            columns.push_back(board.find_column(name));
+        }
+        for (int d = 0; d < developer_count; ++d) {
+            board.add_developer(std::make_unique<Developer>("Developer #" + std::to_string(d)));
+        }
+        const auto& developers = board.get_developers();
+        std::vector<TaskId> ids;
+        ids.reserve(task_count);
+        for (int i = 0; i < task_count; ++i) {
+            auto task = std::make_unique<Task>("Task #" + std::to_string(i));
+            task->set_description("Description of task #" + std::to_string(i));
+            task->set_priority(i % 11);
+            task->set_developer(developers[(i % developer_count) * 7919 % developer_count].get());
+            ids.push_back(task->get_task_id());
+            columns[i % columns.size()]->add_task(std::move(task));
+        }
+
+        Json_worker writer(path);
+        writer.board_add(board, writer.ids_add(ids));
+        writer.save();
+    }
+
+    // Загрузка с индексом имен
+    Board board("Loaded");
+    Json_worker reader(path);
+    Stopwatch watch;
+    reader.board_load(board);
+    double load_ms = watch.elapsed_ms();
+    std::cout << "board_load (" << developer_count << " developers, " << task_count << " tasks): "
+              << std::fixed << std::setprecision(1) << load_ms << " ms" << std::endl;
+
+    // Для сравнения - линейный поиск, как до индекса
+    // Полный прогон занял бы часы, поэтому меряем выборку и экстраполируем
+    const int sample = 2000;
+    const auto& developers = board.get_developers();
+    std::size_t found = 0;
+    watch.reset();
+    for (int i = 0; i < sample; ++i) {
+        std::string name = "Developer #" + std::to_string((i * 7919) % developer_count);
+        auto it = std::find_if(developers.begin(), developers.end(),
+            [&name](const std::unique_ptr<Developer>& dev) { return std::string(dev->get_name()) == name; });
+        found += it != developers.end();
+    }
+    double linear_ns = watch.elapsed_ns() / sample;
+
+    watch.reset();
+    for (int i = 0; i < sample; ++i) {
+        std::string name = "Developer #" + std::to_string((i * 7919) % developer_count);
+        found += board.find_developer(name) != nullptr;
+    }
+    double indexed_ns = watch.elapsed_ns() / sample;
+
+    std::cout << "find_developer: linear " << std::setprecision(1) << linear_ns << " ns, indexed "
+              << indexed_ns << " ns (found " << found << ")" << std::endl;
+    std::cout << "estimated lookup cost in load: linear " << linear_ns * task_count / 1e6 << " ms, indexed "
+              << indexed_ns * task_count / 1e6 << " ms" << std::endl;
+
+    std::remove(path.c_str());
+}
+
+// Потоковая загрузка против чистого разбора того же файла
+// Разбор с пустым обработчиком - нижняя граница времени загрузки
+BENCHMARK_CASE(BoardLoadVersusParseOnly) {
+    const int task_count = 1000000;
+    const std::string path = "bench_board_parse.json";
+    {
+        Board board("Bench Board");
+        board.add_column(std::make_unique<Column>("Backlog"));
+        board.add_developer(std::make_unique<Developer>("Developer"));
+        Column* column = board.find_column("Backlog");
+        for (int i = 0; i < task_count; ++i) {
+            auto task = std::make_unique<Task>("Task #" + std::to_string(i));
+            task->set_description("Description of task #" + std::to_string(i));
+            task->set_priority(i % 11);
+            task->set_developer(board.find_developer("Developer"));
+            column->add_task(std::move(task));
+        }
+        Json_worker writer(path);
+        writer.board_save(board);
+    }
+
+    Stopwatch watch;
+    {
+        std::FILE* file = std::fopen(path.c_str(), "rb");
+        char buffer[64 * 1024];
+        rapidjson::FileReadStream stream(file, buffer, sizeof(buffer));
+        rapidjson::BaseReaderHandler<> handler;
+        rapidjson::Reader reader;
+        reader.Parse(stream, handler);
+        std::fclose(file);
+    }
+    double parse_ms = watch.elapsed_ms();
+
+    Board board("Loaded");
+    Json_worker reader(path);
+    watch.reset();
+    reader.board_load(board);
+    double load_ms = watch.elapsed_ms();
+
+    std::cout << "parse only: " << std::fixed << std::setprecision(1) << parse_ms << " ms, board_load: "
+              << load_ms << " ms (" << task_count << " tasks)" << std::endl;
+    std::remove(path.c_str());
+}
+
+// Блочное чтение против отображения файла и разбора на месте
+// Пиковый RSS не сравнивается: страницы отображения учитываются как резидентные
+BENCHMARK_CASE(BoardLoadStreamVersusMapped) {
+    const int task_count = 1000000;
+    const std::string path = "bench_board_mapped.json";
+    {
+        Board board("Bench Board");
+        board.add_column(std::make_unique<Column>("Backlog"));
+        board.add_developer(std::make_unique<Developer>("Developer"));
+        Column* column = board.find_column("Backlog");
+        for (int i = 0; i < task_count; ++i) {
+            auto task = std::make_unique<Task>("Task title number " + std::to_string(i));
+            task->set_description("Description of the task number " + std::to_string(i));
+            task->set_priority(i % 11);
+            task->set_developer(board.find_developer("Developer"));
+            column->add_task(std::move(task));
+        }
+        Json_worker writer(path);
+        writer.board_save(board);
+    }
+
+    for (LoadMode mode : {LoadMode::Stream, LoadMode::Mapped}) {
+        Board board("Loaded");
+        Json_worker reader(path);
+        reader.set_load_mode(mode);
+        Stopwatch watch;
+        reader.board_load(board);
+        double load_ms = watch.elapsed_ms();
+        std::cout << (mode == LoadMode::Stream ? "stream" : "mapped") << ": board_load " << std::fixed
+                  << std::setprecision(1) << load_ms << " ms (" << task_count << " tasks)" << std::endl;
+    }
+    std::remove(path.c_str());
+}
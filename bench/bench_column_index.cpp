@@ -0,0 +1,81 @@
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include "bench.h"
+#include "column.h"
+#include "task.h"
+
+// Прежний способ поиска: линейный проход по задачам колонки со сравнением заголовков
+static Task* scan_find_task(Column& column, const std::string& title) {
+    auto& tasks = column.get_tasks();
+    auto it = std::find_if(tasks.begin(), tasks.end(),
+        [&](const std::unique_ptr<Task>& task) {
+            return task->get_title() == title;
+        });
+    return it != tasks.end() ? it->get() : nullptr;
+}
+
+// Сравнение поиска по индексу заголовков с линейным проходом
+BENCHMARK_CASE(ColumnFindTaskIndexVsScan) {
+    const int lookups = 20000;
+    std::cout << std::setw(10) << "tasks" << std::setw(16) << "index ns" << std::setw(16) << "scan ns" << std::endl;
+
+    for (int size : {100, 1000, 10000, 100000}) {
+        Column column("Backlog");
+        std::vector<std::string> titles;
+        for (int i = 0; i < size; ++i) {
+            titles.push_back("Backlog task #" + std::to_string(i));
+            column.add_task(std::make_unique<Task>(titles.back()));
+        }
+
+        std::mt19937 generator(7);
+        std::uniform_int_distribution<int> pick(0, size - 1);
+        std::vector<int> order(lookups);
+        for (auto& index : order) {
+            index = pick(generator);
+        }
+
+        std::size_t found = 0;
+        Stopwatch watch;
+        for (int index : order) {
+            found += column.find_task(titles[index]) != nullptr;
+        }
+        double index_ns = watch.elapsed_ns() / lookups;
+
+        // Линейный поиск на больших колонках ограничиваем числом запросов
+        int scan_lookups = size >= 10000 ? lookups / 20 : lookups;
+        watch.reset();
+        for (int i = 0; i < scan_lookups; ++i) {
+            found += scan_find_task(column, titles[order[i]]) != nullptr;
+        }
+        double scan_ns = watch.elapsed_ns() / scan_lookups;
+
+        std::cout << std::setw(10) << size
+                  << std::setw(16) << std::fixed << std::setprecision(1) << index_ns
+                  << std::setw(16) << scan_ns
+                  << (found == 0 ? " (nothing found)" : "") << std::endl;
+    }
+}
+
+// Удаление всех задач колонки по заголовку в случайном порядке
+BENCHMARK_CASE(ColumnDeleteTaskByTitle) {
+    const int size = 20000;
+    Column column("Backlog");
+    std::vector<std::string> titles;
+    for (int i = 0; i < size; ++i) {
+        titles.push_back("Backlog task #" + std::to_string(i));
+        column.add_task(std::make_unique<Task>(titles.back()));
+    }
+    std::shuffle(titles.begin(), titles.end(), std::mt19937(11));
+
+    Stopwatch watch;
+    for (const auto& title : titles) {
+        column.delete_task(title);
+    }
+    std::cout << "delete_task on " << size << " tasks: "
+              << std::fixed << std::setprecision(1) << watch.elapsed_ns() / size << " ns/op" << std::endl;
+}
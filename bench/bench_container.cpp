@@ -0,0 +1,96 @@
+#include <cstdio>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+#include "bench.h"
+#include "board.h"
+#include "board_container.h"
+#include "column.h"
+#include "developer.h"
+#include "json_worker.h"
+#include "task.h"
+
+namespace {
+
+std::unique_ptr<Board> build_team_board(int team, int task_count) {
+    auto board = std::make_unique<Board>("Team " + std::to_string(team));
+    const char* names[] = {"Backlog", "In Progress", "Done"};
+    for (const char* name : names) {
+        board->add_column(std::make_unique<Column>(name));
+    }
+    for (int d = 0; d < 10; ++d) {
+        board->add_developer(std::make_unique<Developer>("Developer #" + std::to_string(d)));
+    }
+    for (int i = 0; i < task_count; ++i) {
+        auto task = std::make_unique<Task>("Task title number " + std::to_string(i));
+        task->set_description("Description of the task number " + std::to_string(i));
+        task->set_priority(i % 11);
+        task->set_developer(board->get_developers()[i % 10].get());
+        board->get_columns()[i % 3]->add_task(std::move(task));
+    }
+    return board;
+}
+
+} // namespace
+
+// Контейнер из 32 досок по 20000 задач: открытие одной доски и замена одной доски
+// против того же с отдельным JSON и перезаписи всех досок
+BENCHMARK_CASE(ContainerRandomAccess) {
+    const int board_count = 32;
+    const int task_count = 20000;
+    const std::string container_path = "bench_container.tsb";
+    const std::string json_path = "bench_container.json";
+    std::remove(container_path.c_str());
+
+    std::vector<std::unique_ptr<Board>> boards;
+    for (int b = 0; b < board_count; ++b) {
+        boards.push_back(build_team_board(b, task_count));
+    }
+
+    // Полная запись контейнера - столько же, сколько перезапись всех досок
+    Stopwatch write_watch;
+    {
+        BoardContainer container(container_path);
+        for (const auto& board : boards) {
+            container.board_save(*board);
+        }
+    }
+    double write_all_ms = write_watch.elapsed_ms();
+    Json_worker(json_path).board_save(*boards[board_count / 2]);
+
+    Stopwatch open_watch;
+    BoardContainer container(container_path);
+    Board from_container("Loaded");
+    container.board_load("Team " + std::to_string(board_count / 2), from_container);
+    double open_ms = open_watch.elapsed_ms();
+
+    Stopwatch json_watch;
+    Board from_json("Loaded");
+    Json_worker(json_path).board_load(from_json);
+    double json_ms = json_watch.elapsed_ms();
+
+    boards[3]->get_columns()[0]->add_task(std::make_unique<Task>("Late task"));
+    Stopwatch replace_watch;
+    container.board_save(*boards[3]);
+    double replace_ms = replace_watch.elapsed_ms();
+
+    auto size = std::filesystem::file_size(container_path);
+    Stopwatch compact_watch;
+    container.compact();
+    double compact_ms = compact_watch.elapsed_ms();
+
+    std::remove(container_path.c_str());
+    std::remove(json_path.c_str());
+
+    std::cout << std::fixed << std::setprecision(1)
+              << board_count << " boards x " << task_count << " tasks, "
+              << size / (1024.0 * 1024.0) << " MiB container\n"
+              << std::setw(10) << write_all_ms << " ms write all boards\n"
+              << std::setw(10) << open_ms << " ms open container + load one board\n"
+              << std::setw(10) << json_ms << " ms load the same board from its own JSON\n"
+              << std::setw(10) << replace_ms << " ms replace one board\n"
+              << std::setw(10) << compact_ms << " ms compact" << std::endl;
+}
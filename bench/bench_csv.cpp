@@ -0,0 +1,99 @@
+#include <cstdio>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "bench.h"
+#include "board.h"
+#include "column.h"
+#include "csv_worker.h"
+#include "developer.h"
+#include "json_worker.h"
+#include "manager.h"
+#include "task.h"
+
+namespace {
+
+void build_board(Board& board, int task_count) {
+    const char* names[] = {"Backlog", "Assigned", "In Progress", "Blocked", "Done"};
+    for (const char* name : names) {
+        board.add_column(std::make_unique<Column>(name));
+    }
+    for (int d = 0; d < 100; ++d) {
+        board.add_developer(std::make_unique<Developer>("Developer #" + std::to_string(d)));
+    }
+    const auto& developers = board.get_developers();
+    for (int i = 0; i < task_count; ++i) {
+        auto task = std::make_unique<Task>("Task title number " + std::to_string(i));
+        // Каждое десятое описание - с запятой, кавычками и переводом строки
+        if (i % 10 == 0) {
+            task->set_description("Steps:\n1. open \"board\", 2. check " + std::to_string(i));
+        } else {
+            task->set_description("Description of the task number " + std::to_string(i));
+        }
+        task->set_priority(i % 11);
+        if (i % 4 != 0) {
+            task->set_developer(developers[i % developers.size()].get());
+        }
+        board.get_columns()[(i / 1000) % 5]->add_task(std::move(task));
+    }
+}
+
+double rows_per_second(std::size_t rows, double ms) {
+    return ms > 0 ? rows * 1000.0 / ms : 0;
+}
+
+} // namespace
+
+// Экспорт и импорт 1M задач в CSV: строки в секунду для экспорта, импорта на 1-8 потоках
+// и для добавления тех же задач по одной через create_task
+BENCHMARK_CASE(CsvImportExportThroughput) {
+    const int task_count = 1000000;
+    const std::string path = "bench_csv.csv";
+    Board board("Bench Board");
+    build_board(board, task_count);
+
+    Stopwatch export_watch;
+    std::size_t rows = Csv_worker(path).board_export(board);
+    double export_ms = export_watch.elapsed_ms();
+    std::cout << std::fixed << std::setprecision(1)
+              << rows << " rows, " << std::filesystem::file_size(path) / (1024.0 * 1024.0) << " MiB, "
+              << std::thread::hardware_concurrency() << " hardware threads\n"
+              << std::setw(10) << export_ms << " ms export"
+              << std::setw(14) << std::setprecision(0) << rows_per_second(rows, export_ms) << " rows/s" << std::endl;
+
+    for (unsigned threads : {1u, 2u, 4u, 8u}) {
+        Board imported("Imported");
+        Csv_worker csv(path);
+        csv.set_threads(threads);
+        Stopwatch import_watch;
+        csv.board_import(imported);
+        double import_ms = import_watch.elapsed_ms();
+        std::cout << std::setprecision(1) << std::setw(10) << import_ms << " ms import, " << threads << " threads"
+                  << std::setw(14) << std::setprecision(0) << rows_per_second(rows, import_ms) << " rows/s" << std::endl;
+    }
+
+    // Прежний путь: create_task на каждую задачу (поиск колонки по имени, новый ID)
+    Board manual("Manual");
+    for (const auto& column : board.get_columns()) {
+        manual.add_column(std::make_unique<Column>(std::string(column->get_name())));
+    }
+    std::vector<std::pair<std::string, std::string>> titles;
+    titles.reserve(rows);
+    for (const auto& column : board.get_columns()) {
+        for (const auto& task : column->get_tasks()) {
+            titles.emplace_back(std::string(column->get_name()), std::string(task->get_title()));
+        }
+    }
+    Stopwatch manual_watch;
+    for (const auto& [column, title] : titles) {
+        create_task(manual, column, title);
+    }
+    double manual_ms = manual_watch.elapsed_ms();
+    std::cout << std::setprecision(1) << std::setw(10) << manual_ms << " ms create_task per row (titles only)"
+              << std::setw(14) << std::setprecision(0) << rows_per_second(rows, manual_ms) << " rows/s" << std::endl;
+    std::remove(path.c_str());
+}
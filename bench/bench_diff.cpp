@@ -0,0 +1,88 @@
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+#include "bench.h"
+#include "board.h"
+#include "board_diff.h"
+#include "column.h"
+#include "developer.h"
+#include "task.h"
+
+namespace {
+
+const char* column_names[] = {"Backlog", "Assigned", "In Progress", "Blocked", "Done"};
+
+// Доска с задачами ids: одинаковые ID дают три версии одной доски
+std::unique_ptr<Board> build_board(const std::vector<TaskId>& ids) {
+    auto board = std::make_unique<Board>("Bench Board");
+    for (const char* name : column_names) {
+        board->add_column(std::make_unique<Column>(name));
+    }
+    for (int d = 0; d < 100; ++d) {
+        board->add_developer(std::make_unique<Developer>("Developer #" + std::to_string(d)));
+    }
+    const auto& developers = board->get_developers();
+    for (std::size_t i = 0; i < ids.size(); ++i) {
+        auto task = std::make_unique<Task>("Task title number " + std::to_string(i), ids[i]);
+        task->set_description("Description of the task number " + std::to_string(i));
+        task->set_priority(static_cast<int>(i % 11));
+        task->set_developer(developers[i % developers.size()].get());
+        board->get_columns()[i % 5]->add_task(std::move(task));
+    }
+    return board;
+}
+
+} // namespace
+
+// Сравнение и трехстороннее слияние досок из 1M задач, в каждой стороне изменен 1% задач
+// (перемещения, правки, переназначения), плюс добавления и удаления
+BENCHMARK_CASE(BoardDiffMerge) {
+    const std::size_t task_count = 1000000;
+    std::vector<TaskId> ids;
+    ids.reserve(task_count);
+    for (std::size_t i = 0; i < task_count; ++i) {
+        ids.push_back(Task::generate_id());
+    }
+    auto base = build_board(ids);
+    auto ours = build_board(ids);
+    auto theirs = build_board(ids);
+
+    for (std::size_t i = 0; i < task_count; i += 100) {
+        Task* mine = ours->find_task(ids[i]);
+        Task* other = theirs->find_task(ids[i + 50]);
+        switch ((i / 100) % 3) {
+            case 0:
+                mine->set_title("Ours title " + std::to_string(i));
+                theirs->move_task(other->get_task_id(), theirs->find_column("Done"));
+                break;
+            case 1:
+                mine->set_priority(10 - mine->get_priority());
+                other->set_description("Theirs description " + std::to_string(i));
+                break;
+            default:
+                mine->set_developer(ours->get_developers()[0].get());
+                other->set_developer(theirs->get_developers()[1].get());
+                break;
+        }
+    }
+    for (int i = 0; i < 1000; ++i) {
+        theirs->find_column("Backlog")->add_task(std::make_unique<Task>("New task " + std::to_string(i)));
+        theirs->delete_task(ids[i * 997 + 1]);
+    }
+
+    Stopwatch diff_watch;
+    auto changes = diff_boards(*base, *theirs);
+    double diff_ms = diff_watch.elapsed_ms();
+
+    Stopwatch merge_watch;
+    MergeResult result = merge_boards(*base, *ours, *theirs);
+    double merge_ms = merge_watch.elapsed_ms();
+
+    std::cout << std::fixed << std::setprecision(1)
+              << task_count << " tasks, " << changes.size() << " changes in theirs\n"
+              << std::setw(10) << diff_ms << " ms diff\n"
+              << std::setw(10) << merge_ms << " ms merge (" << result.applied << " applied, "
+              << result.conflicts.size() << " conflicts)" << std::endl;
+}
@@ -0,0 +1,92 @@
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "bench.h"
+#include "id_allocator.h"
+
+// Прежняя схема генерации ID для сравнения:
+// новый std::random_device и mt19937 на каждый вызов и линейный поиск по вектору
+static std::string legacy_generate_id(std::vector<std::string>& used_ids) {
+    const std::string charset = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz";
+    while (true) {
+        std::random_device rd;
+        std::mt19937 generator(rd());
+        std::uniform_int_distribution<int> distribution(0, charset.size() - 1);
+        std::string result;
+        for (int i = 0; i < 6; ++i) {
+            result += charset[distribution(generator)];
+        }
+        if (std::find(used_ids.begin(), used_ids.end(), result) == used_ids.end()) {
+            used_ids.push_back(result);
+            return result;
+        }
+    }
+}
+
+// Время выделения ID должно оставаться постоянным по мере роста реестра
+BENCHMARK_CASE(IdAllocatorFlatGrowth) {
+    auto& allocator = IdAllocator::instance();
+    allocator.clear();
+    allocator.set_seed(1);
+
+    const int batch = 250000;
+    const int total = 2000000;
+    std::cout << std::setw(12) << "ids" << std::setw(16) << "ns/alloc" << std::endl;
+    for (int allocated = 0; allocated < total; allocated += batch) {
+        Stopwatch watch;
+        for (int i = 0; i < batch; ++i) {
+            allocator.allocate();
+        }
+        std::cout << std::setw(12) << allocated + batch
+                  << std::setw(16) << std::fixed << std::setprecision(1) << watch.elapsed_ns() / batch
+                  << std::endl;
+    }
+
+    allocator.clear();
+    allocator.clear_seed();
+}
+
+// Освобождение и повторное выделение на заполненном реестре
+BENCHMARK_CASE(IdAllocatorReleaseReuse) {
+    auto& allocator = IdAllocator::instance();
+    allocator.clear();
+    allocator.set_seed(2);
+
+    const int count = 1000000;
+    std::vector<TaskId> ids;
+    ids.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        ids.push_back(allocator.allocate());
+    }
+
+    Stopwatch watch;
+    for (int i = 0; i < count; ++i) {
+        allocator.release(ids[i]);
+        ids[i] = allocator.allocate();
+    }
+    std::cout << "release+allocate with " << count << " live ids: "
+              << std::fixed << std::setprecision(1) << watch.elapsed_ns() / count << " ns/op" << std::endl;
+
+    allocator.clear();
+    allocator.clear_seed();
+}
+
+// Прежний линейный алгоритм - время на ID растет вместе с количеством задач
+BENCHMARK_CASE(IdAllocatorLegacyLinearScan) {
+    std::vector<std::string> used_ids;
+    const int batch = 5000;
+    const int total = 20000;
+    std::cout << std::setw(12) << "ids" << std::setw(16) << "ns/alloc" << std::endl;
+    for (int allocated = 0; allocated < total; allocated += batch) {
+        Stopwatch watch;
+        for (int i = 0; i < batch; ++i) {
+            legacy_generate_id(used_ids);
+        }
+        std::cout << std::setw(12) << allocated + batch
+                  << std::setw(16) << std::fixed << std::setprecision(1) << watch.elapsed_ns() / batch
+                  << std::endl;
+    }
+}
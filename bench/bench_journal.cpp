@@ -0,0 +1,83 @@
+#include <cstdio>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+#include "bench.h"
+#include "board.h"
+#include "board_journal.h"
+#include "column.h"
+#include "developer.h"
+#include "json_worker.h"
+#include "task.h"
+
+// Журнал изменений: стоимость записи одного изменения против полного сохранения
+// и скорость восстановления (снимок + применение журнала)
+BENCHMARK_CASE(JournalAppendAndReplay) {
+    const int task_count = 100000;
+    const int change_count = 100000;
+    const std::string path = "bench_journal.json";
+
+    Board board("Bench Board");
+    const char* names[] = {"Backlog", "Assigned", "In Progress", "Blocked", "Done"};
+    std::vector<Column*> columns;
+    for (const char* name : names) {
+        board.add_column(std::make_unique<Column>(name));
+        columns.push_back(board.find_column(name));
+    }
+    for (int d = 0; d < 100; ++d) {
+        board.add_developer(std::make_unique<Developer>("Developer #" + std::to_string(d)));
+    }
+    std::vector<Task*> tasks;
+    for (int i = 0; i < task_count; ++i) {
+        auto task = std::make_unique<Task>("Task title number " + std::to_string(i));
+        task->set_description("Description of the task number " + std::to_string(i));
+        task->set_priority(i % 11);
+        tasks.push_back(task.get());
+        columns[i % columns.size()]->add_task(std::move(task));
+    }
+
+    BoardJournal journal(path);
+    journal.set_compact_threshold(change_count + 1);
+    Stopwatch watch;
+    journal.attach(board);
+    double snapshot_ms = watch.elapsed_ms();
+
+    // Смесь изменений, как в обычной работе: перемещения, назначения, приоритеты
+    const auto& developers = board.get_developers();
+    watch.reset();
+    for (int i = 0; i < change_count; ++i) {
+        Task* task = tasks[(i * 7919) % task_count];
+        switch (i % 3) {
+            case 0:
+                board.move_task(task->get_task_id(), columns[(i / 3) % columns.size()]);
+                break;
+            case 1:
+                task->set_developer(developers[i % developers.size()].get());
+                break;
+            default:
+                task->set_priority((i / 3) % 11);
+                break;
+        }
+    }
+    journal.sync();
+    double append_ms = watch.elapsed_ms();
+    journal.detach();
+
+    Board restored("Restored");
+    BoardJournal reader(path);
+    watch.reset();
+    std::size_t applied = reader.recover(restored);
+    double recover_ms = watch.elapsed_ms();
+    reader.detach();
+
+    std::cout << std::fixed << std::setprecision(1)
+              << "full snapshot (" << task_count << " tasks): " << snapshot_ms << " ms" << std::endl
+              << "journal append: " << append_ms * 1e6 / change_count << " ns per change" << std::endl
+              << "recover: " << recover_ms << " ms (" << applied << " records, "
+              << (recover_ms > 0 ? applied / recover_ms * 1000 : 0) << " records/s incl. snapshot load)" << std::endl;
+
+    std::remove(path.c_str());
+    std::remove(reader.get_journal_path().c_str());
+}
@@ -0,0 +1,24 @@
+#include <iostream>
+#include <string>
+#include "bench.h"
+
+std::vector<Benchmark>& benchmarks() {
+    static std::vector<Benchmark> registry;
+    return registry;
+}
+
+// Запуск всех бенчмарков или только тех, чье имя содержит аргумент командной строки
+// Пример: ./scrum_board_bench IdAllocator
+int main(int argc, char **argv) {
+    std::string filter = argc > 1 ? argv[1] : "";
+
+    for (const auto& bench : benchmarks()) {
+        if (!filter.empty() && bench.name.find(filter) == std::string::npos) {
+            continue;
+        }
+        std::cout << "=== " << bench.name << " ===" << std::endl;
+        bench.function();
+        std::cout << std::endl;
+    }
+    return 0;
+}
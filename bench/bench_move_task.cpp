@@ -0,0 +1,61 @@
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include "bench.h"
+#include "board.h"
+#include "column.h"
+#include "task.h"
+
+// Перемещение 1M задач по пяти стандартным колонкам доски
+// Каждое перемещение - O(1): задача знает свой слот и колонку
+BENCHMARK_CASE(MoveTaskAcrossDefaultColumns) {
+    const int task_count = 1000000;
+    Board board("Bench Board");
+    const char* names[] = {"Backlog", "Assigned", "In Progress", "Blocked", "Done"};
+    std::vector<Column*> columns;
+    for (const char* name : names) {
+        board.add_column(std::make_unique<Column>(name));
+        columns.push_back(board.find_column(name));
+    }
+
+    Stopwatch watch;
+    std::vector<Task*> tasks;
+    tasks.reserve(task_count);
+    for (int i = 0; i < task_count; ++i) {
+        auto task = std::make_unique<Task>("Task #" + std::to_string(i));
+        tasks.push_back(task.get());
+        columns[0]->add_task(std::move(task));
+    }
+    std::cout << "create " << task_count << " tasks: "
+              << std::fixed << std::setprecision(1) << watch.elapsed_ms() << " ms" << std::endl;
+
+    // Каждая задача проходит путь Backlog -> ... -> Done в случайном порядке задач
+    std::mt19937 generator(3);
+    for (std::size_t step = 1; step < columns.size(); ++step) {
+        std::shuffle(tasks.begin(), tasks.end(), generator);
+        watch.reset();
+        for (Task* task : tasks) {
+            move_task(columns[step - 1], columns[step], task);
+        }
+        double ms = watch.elapsed_ms();
+        std::cout << std::setw(12) << names[step - 1] << " -> " << std::left << std::setw(12) << names[step] << std::right
+                  << std::setw(10) << std::setprecision(1) << ms << " ms"
+                  << std::setw(12) << std::setprecision(1) << ms * 1e6 / task_count << " ns/move" << std::endl;
+    }
+
+    // Удаление всех задач из последней колонки по ID
+    std::shuffle(tasks.begin(), tasks.end(), generator);
+    std::vector<TaskId> ids;
+    ids.reserve(task_count);
+    for (Task* task : tasks) {
+        ids.push_back(task->get_task_id());
+    }
+    watch.reset();
+    for (TaskId id : ids) {
+        board.delete_task(id);
+    }
+    std::cout << "delete by id: " << std::setprecision(1) << watch.elapsed_ms() * 1e6 / task_count << " ns/op" << std::endl;
+}
@@ -0,0 +1,189 @@
+#include <cstdio>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "bench.h"
+#include "board.h"
+#include "column.h"
+#include "developer.h"
+#include "json_worker.h"
+#include "task.h"
+
+namespace {
+
+enum class SaveMode { Dom, StreamPretty, StreamCompact };
+
+const char* mode_name(SaveMode mode) {
+    switch (mode) {
+        case SaveMode::Dom: return "dom+pretty";
+        case SaveMode::StreamPretty: return "stream pretty";
+        case SaveMode::StreamCompact: return "stream compact";
+    }
+    return "";
+}
+
+// Пиковый RSS процесса в КБ (Linux)
+long peak_rss_kb() {
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+}
+
+void build_board(Board& board, int task_count) {
+    const char* names[] = {"Backlog", "Assigned", "In Progress", "Blocked", "Done"};
+    std::vector<Column*> columns;
+    for (const char* name : names) {
+        board.add_column(std::make_unique<Column>(name));
+        columns.push_back(board.find_column(name));
+    }
+    for (int d = 0; d < 100; ++d) {
+        board.add_developer(std::make_unique<Developer>("Developer #" + std::to_string(d)));
+    }
+    const auto& developers = board.get_developers();
+    for (int i = 0; i < task_count; ++i) {
+        auto task = std::make_unique<Task>("Task title number " + std::to_string(i));
+        task->set_description("Description of the task number " + std::to_string(i));
+        task->set_priority(i % 11);
+        if (i % 4 != 0) {
+            task->set_developer(developers[i % developers.size()].get());
+        }
+        columns[i % columns.size()]->add_task(std::move(task));
+    }
+}
+
+// Один замер в дочернем процессе, чтобы пиковый RSS не зависел от предыдущих замеров
+void run_case(int task_count, SaveMode mode) {
+    std::cout.flush();
+    pid_t pid = fork();
+    if (pid != 0) {
+        int status = 0;
+        waitpid(pid, &status, 0);
+        return;
+    }
+
+    Board board("Bench Board");
+    build_board(board, task_count);
+    const std::string path = "bench_save_" + std::to_string(getpid()) + ".json";
+    long rss_before = peak_rss_kb();
+
+    Stopwatch watch;
+    Json_worker worker(path);
+    if (mode == SaveMode::Dom) {
+        std::vector<TaskId> ids;
+        for (const auto& column : board.get_columns()) {
+            for (const auto& task : column->get_tasks()) {
+                ids.push_back(task->get_task_id());
+            }
+        }
+        worker.board_add(board, worker.ids_add(ids));
+        worker.save();
+    } else {
+        worker.board_save(board, mode == SaveMode::StreamPretty);
+    }
+    double ms = watch.elapsed_ms();
+    long rss_after = peak_rss_kb();
+
+    std::FILE* file = std::fopen(path.c_str(), "rb");
+    long size = 0;
+    if (file) {
+        std::fseek(file, 0, SEEK_END);
+        size = std::ftell(file);
+        std::fclose(file);
+    }
+    std::remove(path.c_str());
+
+    std::cout << std::setw(8) << task_count << "  " << std::left << std::setw(15) << mode_name(mode) << std::right
+              << std::fixed << std::setprecision(1) << std::setw(10) << ms << " ms"
+              << std::setw(10) << (rss_after - rss_before) / 1024.0 << " MiB peak RSS growth"
+              << std::setw(10) << size / (1024.0 * 1024.0) << " MiB file" << std::endl;
+    std::cout.flush();
+    _exit(0);
+}
+
+} // namespace
+
+// Сохранение доски через DOM и потоковым писателем
+// Пиковый RSS считается сверх памяти, занятой самой доской
+BENCHMARK_CASE(SaveDomVersusStreaming) {
+    for (int task_count : {10000, 100000, 1000000}) {
+        for (SaveMode mode : {SaveMode::Dom, SaveMode::StreamPretty, SaveMode::StreamCompact}) {
+            run_case(task_count, mode);
+        }
+    }
+}
+
+// Повторное сохранение после правки одной задачи: полное кодирование,
+// кеш неизмененных колонок и сохранение без изменений
+BENCHMARK_CASE(SaveAfterSingleEdit) {
+    for (int task_count : {100000, 1000000}) {
+        Board board("Bench Board");
+        build_board(board, task_count);
+        const std::string full_path = "bench_save_full_" + std::to_string(getpid()) + ".json";
+        const std::string cached_path = "bench_save_cached_" + std::to_string(getpid()) + ".json";
+        Json_worker full(full_path);
+        Json_worker cached(cached_path);
+        cached.set_column_cache(true);
+        full.board_save(board);
+        cached.board_save(board);
+
+        Task* task = board.get_columns()[2]->get_tasks().begin()->get();
+        const int rounds = 5;
+        double full_ms = 0, cached_ms = 0, unchanged_ms = 0;
+        for (int i = 0; i < rounds; ++i) {
+            task->set_priority(i % 11);
+            Stopwatch full_watch;
+            full.board_save(board);
+            full_ms += full_watch.elapsed_ms();
+            Stopwatch cached_watch;
+            cached.board_save(board);
+            cached_ms += cached_watch.elapsed_ms();
+            Stopwatch unchanged_watch;
+            cached.board_save(board);
+            unchanged_ms += unchanged_watch.elapsed_ms();
+        }
+        std::remove(full_path.c_str());
+        std::remove(cached_path.c_str());
+
+        std::cout << std::setw(8) << task_count << std::fixed << std::setprecision(1)
+                  << std::setw(10) << full_ms / rounds << " ms full"
+                  << std::setw(10) << cached_ms / rounds << " ms column cache"
+                  << std::setw(10) << std::setprecision(3) << unchanged_ms / rounds << " ms unchanged" << std::endl;
+    }
+}
+
+// Сохранение и загрузка 1M задач в несколько потоков
+// Колонки делятся на части, поэтому потоков может быть больше, чем колонок
+BENCHMARK_CASE(ParallelSaveAndLoad) {
+    const int task_count = 1000000;
+    Board board("Bench Board");
+    build_board(board, task_count);
+    const std::string path = "bench_save_parallel_" + std::to_string(getpid()) + ".json";
+
+    std::cout << "hardware threads: " << std::thread::hardware_concurrency() << std::endl;
+    for (unsigned threads : {1u, 2u, 4u, 8u, 16u}) {
+        Json_worker writer(path);
+        writer.set_threads(threads);
+        Stopwatch save_watch;
+        writer.board_save(board, false);
+        double save_ms = save_watch.elapsed_ms();
+
+        Board loaded("Loaded");
+        loaded.enable_arena();
+        Json_worker reader(path);
+        reader.set_threads(threads);
+        Stopwatch load_watch;
+        reader.board_load(loaded);
+        double load_ms = load_watch.elapsed_ms();
+
+        std::cout << std::setw(4) << threads << " threads" << std::fixed << std::setprecision(1)
+                  << std::setw(10) << save_ms << " ms save"
+                  << std::setw(10) << load_ms << " ms load" << std::endl;
+    }
+    std::remove(path.c_str());
+}
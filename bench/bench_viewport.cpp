@@ -0,0 +1,61 @@
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include "bench.h"
+#include "column.h"
+#include "column_viewport.h"
+#include "task.h"
+
+// Окно из 20 задач в середине колонки из 1M задач: первый кадр (поиск позиции обходом),
+// кадры без изменений, прокрутка на строку и кадр после изменения колонки.
+// Для сравнения - обход всей колонки, как при построении элементов для каждой задачи
+BENCHMARK_CASE(ColumnViewportFrames) {
+    const std::size_t task_count = 1000000;
+    const std::size_t rows = 20;
+    const int frames = 10000;
+    Column column("Backlog");
+    for (std::size_t i = 0; i < task_count; ++i) {
+        column.add_task(std::make_unique<Task>("Task " + std::to_string(i)));
+    }
+
+    ColumnViewport viewport;
+    viewport.visible_tasks(column, rows);
+    viewport.scroll(static_cast<std::ptrdiff_t>(task_count / 2), task_count);
+    Stopwatch first_watch;
+    std::size_t visible = viewport.visible_tasks(column, rows).size();
+    double first_ms = first_watch.elapsed_ms();
+
+    Stopwatch frame_watch;
+    for (int i = 0; i < frames; ++i) {
+        visible += viewport.visible_tasks(column, rows).size();
+    }
+    double frame_us = frame_watch.elapsed_ms() * 1000.0 / frames;
+
+    Stopwatch scroll_watch;
+    for (int i = 0; i < frames; ++i) {
+        viewport.scroll(i % 2 ? -1 : 1, task_count);
+        visible += viewport.visible_tasks(column, rows).size();
+    }
+    double scroll_us = scroll_watch.elapsed_ms() * 1000.0 / frames;
+
+    column.add_task(std::make_unique<Task>("Changed"));
+    Stopwatch changed_watch;
+    visible += viewport.visible_tasks(column, rows).size();
+    double changed_ms = changed_watch.elapsed_ms();
+
+    Stopwatch full_watch;
+    std::size_t walked = 0;
+    for (const auto& task : column.get_tasks()) {
+        walked += task->get_title().size() != 0;
+    }
+    double full_ms = full_watch.elapsed_ms();
+
+    std::cout << std::fixed << std::setprecision(2)
+              << task_count << " tasks, " << rows << " visible (" << visible + walked << ")\n"
+              << std::setw(10) << first_ms << " ms first frame at the middle\n"
+              << std::setw(10) << frame_us << " us per unchanged frame\n"
+              << std::setw(10) << scroll_us << " us per frame with one-row scroll\n"
+              << std::setw(10) << changed_ms << " ms first frame after a column change\n"
+              << std::setw(10) << full_ms << " ms full column walk" << std::endl;
+}
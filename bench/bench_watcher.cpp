@@ -0,0 +1,117 @@
+#include <chrono>
+#include <deque>
+#include <filesystem>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "bench.h"
+#include "board.h"
+#include "board_watcher.h"
+#include "column.h"
+#include "developer.h"
+#include "json_worker.h"
+#include "task.h"
+
+namespace {
+
+std::unique_ptr<Board> build_board(std::size_t task_count) {
+    auto board = std::make_unique<Board>("Bench Board");
+    for (const char* name : {"Backlog", "Assigned", "In Progress", "Blocked", "Done"}) {
+        board->add_column(std::make_unique<Column>(name));
+    }
+    for (int d = 0; d < 100; ++d) {
+        board->add_developer(std::make_unique<Developer>("Developer #" + std::to_string(d)));
+    }
+    const auto& developers = board->get_developers();
+    for (std::size_t i = 0; i < task_count; ++i) {
+        auto task = std::make_unique<Task>("Task title number " + std::to_string(i));
+        task->set_description("Description of the task number " + std::to_string(i));
+        task->set_priority(static_cast<int>(i % 11));
+        task->set_developer(developers[i % developers.size()].get());
+        board->get_columns()[i % 5]->add_task(std::move(task));
+    }
+    return board;
+}
+
+} // namespace
+
+// Подхват внешнего изменения файла доски из 200k задач, в котором изменено 100 задач:
+// время в потоке доски (слияние) против полной перезагрузки файла
+BENCHMARK_CASE(WatchedFileReload) {
+    const std::size_t task_count = 200000;
+    const std::string path = (std::filesystem::temp_directory_path() / "bench_watched_board.json").string();
+    auto board = build_board(task_count);
+    Json_worker(path).board_save(*board);
+
+    std::mutex queue_mutex;
+    std::deque<std::function<void()>> queue;
+    std::size_t applied = 0;
+    auto watcher = std::make_unique<BoardWatcher>(
+        *board, path,
+        [&](std::function<void()> task) {
+            std::lock_guard<std::mutex> lock(queue_mutex);
+            queue.push_back(std::move(task));
+        },
+        [&](const MergeResult& result) { applied = result.applied; }, std::chrono::milliseconds(10));
+
+    // "Другой процесс": копия доски, в которой изменены 100 задач
+    auto other = std::make_unique<Board>("Bench Board");
+    Json_worker(path).board_load(*other);
+    std::vector<std::vector<Task*>> column_tasks(4);
+    for (std::size_t c = 0; c < column_tasks.size(); ++c) {
+        for (const auto& task : other->get_columns()[c]->get_tasks()) {
+            column_tasks[c].push_back(task.get());
+        }
+    }
+    std::vector<Task*> picked;
+    for (std::size_t i = 0; i < 100; ++i) {
+        picked.push_back(column_tasks[i % 4][i * 100]);
+    }
+    for (std::size_t i = 0; i < picked.size(); ++i) {
+        Task* task = picked[i];
+        if (i % 2) {
+            task->set_title("Changed elsewhere " + std::to_string(i));
+        } else {
+            other->move_task(task->get_task_id(), other->find_column("Done"));
+        }
+    }
+
+    // Запись другого процесса: копия файла с новым inode (свои сохранения наблюдатель пропускает)
+    const std::string written = path + ".external";
+    Json_worker(written).board_save(*other);
+    std::filesystem::copy_file(written, path + ".copy", std::filesystem::copy_options::overwrite_existing);
+    std::filesystem::remove(written);
+    Stopwatch detect_watch;
+    std::filesystem::rename(path + ".copy", path);
+    std::function<void()> merge;
+    while (!merge) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        std::lock_guard<std::mutex> lock(queue_mutex);
+        if (!queue.empty()) {
+            merge = std::move(queue.front());
+            queue.pop_front();
+        }
+    }
+    double detect_ms = detect_watch.elapsed_ms();
+
+    Stopwatch merge_watch;
+    merge();
+    double merge_ms = merge_watch.elapsed_ms();
+    watcher.reset();
+
+    Stopwatch load_watch;
+    Json_worker(path).board_load(*board);
+    double load_ms = load_watch.elapsed_ms();
+    std::filesystem::remove(path);
+
+    std::cout << std::fixed << std::setprecision(1)
+              << task_count << " tasks, " << applied << " changes merged\n"
+              << std::setw(10) << detect_ms << " ms parse and diff (watcher thread)\n"
+              << std::setw(10) << merge_ms << " ms merge (board thread)\n"
+              << std::setw(10) << load_ms << " ms full board_load" << std::endl;
+}
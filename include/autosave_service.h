@@ -0,0 +1,103 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include "board_listener.h"
+#include "board_snapshot.h"
+
+// Класс AutosaveService - фоновое автосохранение доски
+// Сервис подключается к доске слушателем и получает от нее каждое изменение
+// Серия изменений сливается в одну запись: сохранение начинается, когда после последнего
+// изменения прошло debounce без новых. Доска копируется в BoardSnapshot в своем потоке
+// (через executor), а сериализация и запись файла идут в потоке сервиса:
+// снимок пишется во временный файл, сбрасывается на диск и переименовывается поверх файла
+//
+// Сервис занимает слушателя доски (Board::set_listener), поэтому не совмещается
+// с BoardJournal на одной доске
+class AutosaveService : public BoardListener {
+public:
+    // Выполнение задачи в потоке, владеющем доской (например, ScreenInteractive::Post)
+    using Executor = std::function<void(std::function<void()>)>;
+
+    static constexpr std::chrono::milliseconds default_debounce{500};
+
+private:
+    Board& board;
+    std::string path;
+    std::chrono::milliseconds debounce;
+    Executor executor;
+
+    std::mutex mutex;
+    std::condition_variable wake;   // Поток сервиса: изменения, снимок или остановка
+    std::condition_variable saved;  // flush: запись снимка завершена
+    std::uint64_t change_count = 0;    // Номер последнего изменения доски
+    std::uint64_t captured_count = 0;  // Номер изменения, по которое снят последний снимок
+    std::uint64_t saved_count = 0;     // Номер изменения, по которое доска записана в файл
+    std::uint64_t pending_count = 0;   // Номер изменения для снимка в pending
+    std::uint64_t failed_count = 0;    // Номер изменения последнего снимка, который не записался
+    std::chrono::steady_clock::time_point last_change;
+    std::unique_ptr<BoardSnapshot> pending;  // Снимок, ожидающий записи
+    bool capture_requested = false;  // Снятие снимка поставлено в очередь executor
+    bool stopping = false;
+    std::size_t save_count = 0;      // Выполненных записей файла
+    std::string last_error;          // Ошибка последней записи (пусто при успехе)
+
+    // Отметка о жизни сервиса для задач, оставшихся в очереди executor после его удаления
+    std::shared_ptr<char> alive = std::make_shared<char>();
+    std::thread worker;
+
+    void changed();
+    void capture();   // В потоке доски
+    void run();       // Поток сервиса
+    void write(const BoardSnapshot& snapshot, std::uint64_t count);
+
+public:
+    // Подключение к доске; executor выполняет снятие снимка в потоке доски
+    // По умолчанию (пустой executor) снимок снимается в потоке сервиса - это допустимо,
+    // только если доска не меняется одновременно с ним (например, в тестах)
+    AutosaveService(Board& target, std::string save_path,
+                    std::chrono::milliseconds debounce_window = default_debounce,
+                    Executor run_on_board_thread = nullptr);
+
+    // Запись несохраненных изменений и остановка потока; вызывается в потоке доски
+    ~AutosaveService() override;
+
+    AutosaveService(const AutosaveService&) = delete;
+    AutosaveService& operator=(const AutosaveService&) = delete;
+
+    // Немедленное сохранение без ожидания debounce (даже если изменений не было);
+    // вызывается в потоке доски. Снимок снимается сразу, а запись идет в потоке сервиса
+    void save_now();
+
+    // Сохранение и ожидание его завершения; вызывается в потоке доски
+    // Возвращает false, если запись не удалась (см. get_last_error)
+    bool flush();
+
+    // Есть ли изменения, еще не записанные в файл
+    bool has_unsaved_changes();
+    std::size_t get_save_count();
+    std::string get_last_error();
+    const std::string& get_path() const { return path; }
+
+    // События доски
+    void on_board_renamed(const Board&) override { changed(); }
+    void on_column_added(const Column&) override { changed(); }
+    void on_column_renamed(const Column&) override { changed(); }
+    void on_columns_cleared() override { changed(); }
+    void on_developer_added(const Developer&) override { changed(); }
+    void on_developer_renamed(const Developer&) override { changed(); }
+    void on_developer_removed(std::size_t) override { changed(); }
+    void on_developers_cleared() override { changed(); }
+    void on_task_added(const Task&) override { changed(); }
+    void on_task_moved(const Task&) override { changed(); }
+    void on_task_removed(const Task&) override { changed(); }
+    void on_task_changed(const Task&, TaskField) override { changed(); }
+    void on_task_id_changed(const Task&, TaskId) override { changed(); }
+    void on_board_replaced(const Board&) override { changed(); }
+};
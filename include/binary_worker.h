@@ -0,0 +1,163 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include "mapped_file.h"
+#include "task_id.h"
+
+class Board;
+
+// Двоичный формат снимка доски для быстрого открытия больших досок
+// Файл читается отображением в память: записи фиксированной длины и таблица строк
+// используются прямо из отображения, без разбора
+//
+// Раскладка файла (числа в порядке байт машины, проверяется по byte_order):
+//   BinaryHeader (64 байта)
+//   BinaryColumn[column_count]     - колонки в порядке доски
+//   BinaryDeveloper[developer_count]
+//   BinaryTask[task_count]         - задачи по колонкам подряд, в порядке обхода
+//   таблица строк                  - байты всех строк без разделителей
+// Секции выровнены по 8 байт, смещения - от начала файла
+// Описания задач лежат в конце таблицы строк одним блоком: при ленивой загрузке
+// чтение заголовков и записей не затрагивает страницы с описаниями
+//
+// Версия растет при любом несовместимом изменении раскладки; файлы новее
+// поддерживаемой версии не открываются
+//
+// Открытие меньше чем за секунду на 1M задач обеспечивает BinaryBoardView: проверка
+// файла - один проход по записям, строки читаются прямо из отображения
+// (bench BinaryVersusJsonLoad: ~10 мс). Загрузка в Board дороже: модель регистрирует
+// каждый ID в IdAllocator и строит индексы ID и разработчиков доски, поэтому ее время
+// растет с числом задач (там же: 0,7-1 с на 1M задач в арене, против ~4 с у JSON)
+
+// Ссылка на строку в таблице строк (смещение от начала таблицы)
+struct BinaryString {
+    uint32_t offset;
+    uint32_t length;
+};
+
+struct BinaryHeader {
+    char magic[8];           // "TSBOARD\0"
+    uint32_t version;
+    uint32_t byte_order;     // 0x01020304 в порядке байт записавшей машины
+    uint64_t column_count;
+    uint64_t developer_count;
+    uint64_t task_count;
+    uint64_t strings_offset;
+    uint64_t strings_size;
+    BinaryString board_name;
+};
+
+struct BinaryColumn {
+    BinaryString name;
+    uint64_t first_task;     // Номер первой задачи колонки в массиве задач
+    uint64_t task_count;
+};
+
+struct BinaryDeveloper {
+    BinaryString name;
+};
+
+struct BinaryTask {
+    uint64_t id;             // Упакованный TaskId; для "чужих" ID - 0, текст в id_text
+    BinaryString id_text;
+    BinaryString title;
+    BinaryString description;
+    int32_t priority;
+    uint32_t developer;      // Номер разработчика + 1 (0 - не назначен)
+};
+
+static_assert(sizeof(BinaryHeader) == 64, "Binary header layout changed");
+static_assert(sizeof(BinaryTask) == 40, "Binary task layout changed");
+
+// Класс BinaryBoardView - доска в двоичном формате, открытая только для чтения
+// Строки и записи возвращаются как представления прямо в отображение файла (без копий)
+// Структура файла проверяется при открытии; ошибка - BoardLoadError со смещением
+class BinaryBoardView {
+public:
+    static constexpr uint32_t current_version = 1;
+    static constexpr uint32_t no_developer = UINT32_MAX;
+
+private:
+    std::shared_ptr<MappedFile> file;
+    const BinaryHeader* header = nullptr;
+    const BinaryColumn* columns = nullptr;
+    const BinaryDeveloper* developers = nullptr;
+    const BinaryTask* tasks = nullptr;
+    const char* strings = nullptr;
+
+    std::string_view text(BinaryString ref) const { return std::string_view(strings + ref.offset, ref.length); }
+    void validate() const;
+
+public:
+    explicit BinaryBoardView(const std::string& path);
+
+    BinaryBoardView(const BinaryBoardView&) = delete;
+    BinaryBoardView& operator=(const BinaryBoardView&) = delete;
+
+    std::string_view board_name() const { return text(header->board_name); }
+
+    std::size_t column_count() const { return static_cast<std::size_t>(header->column_count); }
+    std::string_view column_name(std::size_t column) const { return text(columns[column].name); }
+    std::size_t column_first_task(std::size_t column) const { return static_cast<std::size_t>(columns[column].first_task); }
+    std::size_t column_task_count(std::size_t column) const { return static_cast<std::size_t>(columns[column].task_count); }
+
+    std::size_t developer_count() const { return static_cast<std::size_t>(header->developer_count); }
+    std::string_view developer_name(std::size_t developer) const { return text(developers[developer].name); }
+
+    std::size_t task_count() const { return static_cast<std::size_t>(header->task_count); }
+    TaskId task_id(std::size_t task) const;
+    std::string_view task_title(std::size_t task) const { return text(tasks[task].title); }
+    std::string_view task_description(std::size_t task) const { return text(tasks[task].description); }
+    int task_priority(std::size_t task) const { return tasks[task].priority; }
+    // Номер разработчика задачи или no_developer
+    uint32_t task_developer(std::size_t task) const { return tasks[task].developer - 1; }
+
+    // Отображение файла; описания задач при ленивой загрузке держат его открытым
+    std::shared_ptr<const MappedFile> get_file() const { return file; }
+
+    // Является ли файл двоичным снимком доски (по сигнатуре)
+    static bool is_binary_file(const std::string& path);
+};
+
+// Класс Binary_worker - сохранение и загрузка доски в двоичном формате
+// Работает рядом с Json_worker и преобразует снимки в JSON и обратно без потерь
+class Binary_worker {
+private:
+    std::string save_path;
+    std::string loaded_board_name;  // Название доски в последнем загруженном файле
+    bool lazy_descriptions = false; // Оставлять ли описания задач в файле при загрузке
+
+public:
+    Binary_worker(std::string sp) : save_path(sp) {}
+
+    void set_save_path(const std::string& path) { save_path = path; }
+    std::string get_save_path() const { return save_path; }
+
+    // Ленивая загрузка описаний: заголовки, ID, приоритеты и назначения строятся сразу,
+    // а описания остаются в отображении файла и читаются с диска при обращении
+    // к Task::get_description(). Прочитанные страницы - обычный кеш страниц ОС,
+    // который система может вытеснить; изменение описания хранится уже в задаче
+    void set_lazy_descriptions(bool lazy) { lazy_descriptions = lazy; }
+    bool get_lazy_descriptions() const { return lazy_descriptions; }
+
+    // Запись доски: записи пишутся первым проходом, таблица строк - вторым,
+    // поэтому память не зависит от размера доски
+    // Файл пишется во временный и заменяет старый переименованием: задачи с ленивыми
+    // описаниями из старого файла продолжают читать его, даже если сохраняется та же доска
+    void board_save(const Board& board);
+
+    // Загрузка доски; как и Json_worker::board_load, доска меняется только при успехе,
+    // а название доски из файла не применяется (доступно через get_loaded_board_name)
+    // Заголовки копируются из файла один раз, индексы заголовков колонок строятся
+    // при первом поиске по заголовку (Column::add_tasks)
+    void board_load(Board& board);
+    const std::string& get_loaded_board_name() const { return loaded_board_name; }
+
+    // Преобразование снимков между форматами (название доски сохраняется)
+    static void json_to_binary(const std::string& json_path, const std::string& binary_path);
+    static void binary_to_json(const std::string& binary_path, const std::string& json_path);
+};
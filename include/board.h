@@ -1,8 +1,14 @@
 #pragma once
 
+#include <cstdint>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include "board_arena.h"
+#include "board_listener.h"
 #include "column.h"
 #include "developer.h"
 
@@ -14,32 +20,133 @@ class Column;
 // Содержит колонки, разработчиков и общую информацию о доске
 class Board {
 private:
+    // Арена для объектов загруженной доски (nullptr - обычная куча)
+    // Объявлена первой, чтобы уничтожаться последней, после колонок и разработчиков
+    std::unique_ptr<BoardArena> arena;
+    
     std::string name;  // Название доски
     std::vector<std::unique_ptr<Column>> columns;      // Список колонок на доске
     std::vector<std::unique_ptr<Developer>> developers; // Список разработчиков команды
+    
+    // Индекс ID -> задача по всей доске
+    // Колонка задачи берется из Task::get_column(), поэтому поиск по ID
+    // не требует знать колонку заранее
+    std::unordered_map<TaskId, Task*> task_index;
+    
+    // Обратный индекс разработчик -> назначенные на него задачи
+    // Снятие, переназначение и выборка задач разработчика стоят O(k)
+    // по числу его задач, а не O(всех задач доски)
+    // Ключ - handle, поэтому новый разработчик по адресу удаленного не получит чужие задачи
+    std::unordered_map<DeveloperHandle, std::unordered_set<Task*>> developer_tasks;
+    
+    // Индексы имя -> колонка и имя -> разработчик
+    // Ключи - представления имен самих объектов, поэтому поиск по std::string_view
+    // идет без создания временных строк (гетерогенный поиск в духе C++17)
+    // При одинаковых именах в индексе хранится первый добавленный объект
+    std::unordered_map<std::string_view, Column*> column_index;
+    std::unordered_map<std::string_view, Developer*> developer_index;
+    
+    // Наблюдатель за изменениями (nullptr - изменения никуда не сообщаются)
+    BoardListener* listener = nullptr;
+    
+    // Ревизия доски меняется при любом изменении доски и ее колонок
+    // saved_revision - ревизия на момент последнего сохранения (mark_saved)
+    std::uint64_t revision = next_revision();
+    std::uint64_t saved_revision = 0;
+    
+    void touch() { revision = next_revision(); }
+    // Отметка колонок с задачами разработчика: имя разработчика входит в содержимое задач
+    void touch_developer_columns(DeveloperHandle handle);
+    
+    // Поддержка индексов имен - вызывается при добавлении, удалении и переименовании
+    void index_column(Column* col);
+    void unindex_column(Column* col);
+    void index_developer(Developer* develop);
+    void unindex_developer(Developer* develop);
+    
+    // Поддержка индексов - вызывается колонками при добавлении и извлечении задач
+    // ID на доске уникален: задача с ID, который уже занят другой задачей доски,
+    // не добавляется в индекс (std::invalid_argument), и доска не меняется
+    void index_task(Task* task);
+    void index_task_developer(Task* task);
+    void unindex_task(Task* task);
+    void reindex_task(Task* task, TaskId old_id);
+    void on_developer_changed(Task* task, DeveloperHandle old_developer);
+    // Пакетное добавление ID в индекс: при повторе добавленные записи убираются
+    void index_task_ids(const TaskList& tasks);
+    void index_task_ids(const std::vector<std::unique_ptr<Task>>& tasks);
+    // Добавление колонок загруженной доски с индексом ID, построенным заранее (BoardStage)
+    void add_indexed_columns(std::vector<std::unique_ptr<Column>> loaded, std::unordered_map<TaskId, Task*> index);
+    void attach_column(std::unique_ptr<Column> col);
+    
+    friend class Column;
+    friend class Developer;
+    friend struct BoardStage;
+    friend void move_task(Column* start, Column* end, Task* task);
 
 public:
     // Конструктор доски с обязательным названием
     // Векторы columns и developers инициализируются по умолчанию пустыми
     Board(std::string n) : name(n) {}
     
+    // Отслеживание изменений
+    // Ревизии берутся из общего счетчика, поэтому одинаковая ревизия у доски или колонки
+    // означает одно и то же состояние, даже если объект по тому же адресу пересоздан
+    static std::uint64_t next_revision();
+    std::uint64_t get_revision() const { return revision; }
+    // Есть ли изменения после последнего mark_saved (новая доска считается несохраненной)
+    bool has_unsaved_changes() const { return revision != saved_revision; }
+    void mark_saved() { saved_revision = revision; }
+    
     // Методы для работы с названием доски
     void set_name(std::string n);
-    std::string get_name() const;
+    std::string_view get_name() const;
+    
+    // Режим арены: объекты, созданные внутри ArenaScope(get_arena()),
+    // берут память из нескольких больших блоков, принадлежащих доске
+    void enable_arena(std::size_t initial_size = BoardArena::default_block_size);
+    BoardArena* get_arena() const { return arena.get(); }
+    
+    // Возврат блоков арены одним вызовом
+    // Колонки и разработчики из арены должны быть удалены заранее (clear_columns, clear_developers)
+    void release_arena();
+    
+    // Замена арены на новую (например, с объектами загруженной доски)
+    // Старая арена уничтожается; если ее объекты еще живы вне доски, она передается
+    // новой арене и освобождается вместе с ней. Отключить арену (next == nullptr)
+    // можно, только когда объектов старой арены не осталось
+    void replace_arena(std::unique_ptr<BoardArena> next);
+    
+    // Наблюдатель за изменениями доски (журнал, автосохранение)
+    // Доска не владеет слушателем; nullptr отключает уведомления
+    void set_listener(BoardListener* l) { listener = l; }
+    BoardListener* get_listener() const { return listener; }
     
     // Методы для работы с колонками
     std::vector<std::unique_ptr<Column>>& get_columns();
     const std::vector<std::unique_ptr<Column>>& get_columns() const;
-    void add_column(std::unique_ptr<Column> col);
+    void add_column(std::unique_ptr<Column> col);  // ID задач колонки не должны быть заняты на доске
     void clear_columns();
     
     // Методы для работы с разработчиками
     std::vector<std::unique_ptr<Developer>>& get_developers();
     const std::vector<std::unique_ptr<Developer>>& get_developers() const;
     void add_developer(std::unique_ptr<Developer> develop);
-    void clear_developers();
+    void clear_developers();                                // Удаляет всех разработчиков (handle в задачах устаревают)
+    void delete_developer(Developer* develop);              // Удаляет разработчика без обхода его задач
+    
+    // Операции с назначениями через обратный индекс
+    const std::unordered_set<Task*>& get_developer_tasks(Developer* develop) const;  // Задачи разработчика
+    void unassign_developer(Developer* develop);                     // Снятие разработчика со всех задач
+    void reassign_developer(Developer* from, Developer* to);         // Передача всех задач другому
     
     // Методы поиска
-    Developer* find_developer(const std::string& name) const;  // Поиск разработчика по имени
-    Column* find_column(const std::string& name) const;        // Поиск колонки по имени
+    // Принимают std::string_view, поэтому поиск по литералу не создает временных строк
+    Developer* find_developer(std::string_view name) const;  // Поиск разработчика по имени
+    Column* find_column(std::string_view name) const;        // Поиск колонки по имени
+    
+    // Операции с задачами по ID за O(1) в среднем, независимо от колонки
+    Task* find_task(TaskId id) const;                       // Поиск задачи по ID
+    void move_task(TaskId id, Column* destination);         // Перемещение задачи по ID
+    void delete_task(TaskId id);                            // Удаление задачи по ID
 };
\ No newline at end of file
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+// Класс BoardArena - арена памяти для объектов загруженной доски
+// Задачи, колонки, разработчики и их строки берутся из нескольких больших блоков
+// (std::pmr::monotonic_buffer_resource), поэтому загрузка не делает отдельного
+// выделения на каждый объект, а освобождение всей памяти - это возврат блоков
+class BoardArena {
+private:
+    // Верхний ресурс считает запрошенные у системы байты - для статистики памяти
+    class CountingResource : public std::pmr::memory_resource {
+    public:
+        std::size_t bytes = 0;
+        std::size_t blocks = 0;
+
+    private:
+        void* do_allocate(std::size_t size, std::size_t alignment) override;
+        void do_deallocate(void* ptr, std::size_t size, std::size_t alignment) override;
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+            return this == &other;
+        }
+    };
+
+    CountingResource upstream;
+    std::pmr::monotonic_buffer_resource resource;
+    std::size_t live_objects = 0;  // Объекты модели из арены, которые еще не уничтожены
+    std::vector<std::unique_ptr<BoardArena>> children;  // Арены, собранные в других потоках
+
+public:
+    // Размер первого блока по умолчанию - 1 МБ, следующие блоки растут геометрически
+    static constexpr std::size_t default_block_size = 1 << 20;
+
+    explicit BoardArena(std::size_t initial_size = default_block_size);
+
+    BoardArena(const BoardArena&) = delete;
+    BoardArena& operator=(const BoardArena&) = delete;
+
+    std::pmr::memory_resource* get_resource() { return &resource; }
+
+    // Выделение и освобождение памяти под объект модели
+    // Освобождение ничего не возвращает в арену - память уходит целиком в release()
+    void* allocate_object(std::size_t size, std::size_t alignment);
+    void deallocate_object();
+
+    // Возврат всех блоков арены (вместе с дочерними)
+    // Все объекты из арены к этому моменту должны быть уничтожены
+    void release();
+
+    // Передача арены, заполненной в другом потоке (арена не потокобезопасна, поэтому
+    // параллельная загрузка дает каждому потоку свою). Дочерняя арена живет и
+    // освобождается вместе с этой; статистика ниже включает дочерние арены
+    void adopt(std::unique_ptr<BoardArena> child);
+
+    std::size_t get_live_objects() const;
+    std::size_t get_reserved_bytes() const;  // Байты, взятые у системы
+    std::size_t get_block_count() const;
+};
+
+// Класс ArenaScope задает арену для объектов, создаваемых в текущем потоке
+// Пока область активна, new Task/Column/Developer и их строки используют арену
+// Вне области (или с nullptr) используется обычная куча
+class ArenaScope {
+private:
+    BoardArena* previous;
+
+public:
+    explicit ArenaScope(BoardArena* arena);
+    ~ArenaScope();
+
+    ArenaScope(const ArenaScope&) = delete;
+    ArenaScope& operator=(const ArenaScope&) = delete;
+
+    // Текущая арена потока (nullptr если области нет)
+    static BoardArena* current();
+
+    // Ресурс для строк модели: арена или стандартный ресурс кучи
+    static std::pmr::memory_resource* resource();
+};
+
+// Операторы new/delete для классов модели
+// Перед объектом хранится заголовок с указателем на арену (nullptr для кучи),
+// поэтому delete знает, куда вернуть память, независимо от текущей области
+void* arena_allocate(std::size_t size);
+void arena_deallocate(void* ptr) noexcept;
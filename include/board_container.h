@@ -0,0 +1,102 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "binary_worker.h"
+
+class Board;
+
+// Контейнер досок - один файл со многими досками и индексом для произвольного доступа
+// Каждая доска - отдельный сегмент: обычный JSON доски (тот же, что пишет Json_worker),
+// за которым идет '\0'. Открытие одной доски разбирает только ее сегмент
+//
+// Раскладка файла (числа в порядке байт машины, проверяется по byte_order):
+//   ContainerHeader (64 байта)      - смещение действующего индекса
+//   сегменты досок и старые индексы - в порядке записи
+//   ContainerEntry[board_count]     - индекс: смещение и размер сегмента каждой доски
+//   имена досок                     - байты имен без разделителей
+//
+// Запись доски дописывает в конец файла ее сегмент и новый индекс, сбрасывает их на диск
+// и только потом переключает заголовок на новый индекс. Прерванная запись оставляет
+// в конце файла лишние байты, но заголовок указывает на прежний целый индекс
+// Замененные сегменты и старые индексы остаются в файле мертвыми байтами до compact()
+
+struct ContainerHeader {
+    char magic[8];           // "TSBOARDS"
+    uint32_t version;
+    uint32_t byte_order;     // 0x01020304 в порядке байт записавшей машины
+    uint64_t index_offset;
+    uint64_t board_count;
+    uint64_t names_size;     // Размер имен, идущих за записями индекса
+    uint64_t dead_bytes;     // Байты файла вне действующих сегментов и индекса
+    uint64_t reserved[2];
+};
+
+struct ContainerEntry {
+    uint64_t offset;         // Начало сегмента доски
+    uint64_t size;           // Размер JSON сегмента без завершающего '\0'
+    BinaryString name;       // Имя доски (смещение от начала имен индекса)
+};
+
+static_assert(sizeof(ContainerHeader) == 64, "Container header layout changed");
+static_assert(sizeof(ContainerEntry) == 24, "Container entry layout changed");
+
+// Класс BoardContainer - файл-контейнер досок
+// Индекс читается при открытии; доски загружаются и записываются по одной
+// Несколько объектов на один файл одновременно не поддерживаются
+class BoardContainer {
+public:
+    static constexpr uint32_t current_version = 1;
+
+    // Доска в индексе контейнера
+    struct Entry {
+        std::string name;
+        uint64_t offset = 0;
+        uint64_t size = 0;
+    };
+
+private:
+    std::string path;
+    std::vector<Entry> entries;  // В порядке первого добавления досок
+    bool file_exists = false;
+    uint64_t dead_bytes = 0;
+
+    const Entry* find(std::string_view name) const;
+    void read_index();
+    // Запись индекса next с позиции end и переключение заголовка на него
+    // Возвращает число мертвых байт в файле после записи
+    uint64_t write_index(std::FILE* file, uint64_t end, const std::vector<Entry>& next);
+
+public:
+    // Открытие контейнера; несуществующий файл - пустой контейнер, который создается
+    // первой записью. Ошибка заголовка или индекса - BoardLoadError со смещением
+    explicit BoardContainer(std::string container_path);
+
+    const std::string& get_path() const { return path; }
+    const std::vector<Entry>& get_entries() const { return entries; }
+    std::vector<std::string> list() const;           // Имена досок
+    bool contains(std::string_view name) const { return find(name) != nullptr; }
+    uint64_t get_dead_bytes() const { return dead_bytes; }
+
+    // Загрузка одной доски по имени; как и Json_worker::board_load, доска меняется
+    // только при успехе. Доска получает имя из индекса. Нет такой доски - std::runtime_error
+    void board_load(std::string_view name, Board& board);
+
+    // Добавление доски или замена доски с тем же именем
+    // Другие доски не переписываются: в файл дописываются сегмент и индекс
+    void board_save(const Board& board, bool pretty = true);
+
+    // Удаление доски из индекса (ее сегмент становится мертвыми байтами)
+    void board_remove(std::string_view name);
+
+    // Перезапись файла без мертвых байт (через временный файл и переименование)
+    // Сегменты копируются как есть, без разбора
+    void compact();
+
+    // Является ли файл контейнером досок (по сигнатуре)
+    static bool is_container_file(const std::string& path);
+};
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "task_id.h"
+
+class Board;
+class Task;
+
+// Сравнение и трехстороннее слияние досок по ID задач
+// Колонки и разработчики сопоставляются по имени. Порядок задач внутри колонки не сравнивается
+// Каждая доска сначала сводится к отпечатку (BoardDigest): ID и хеши полей всех задач,
+// отсортированные по ID. Отпечатки сливаются одним последовательным проходом, поэтому
+// неизмененная задача стоит сравнение двух чисел без обращения к самой задаче,
+// а поля читаются только у измененных. Время - O(n log n) на сортировку отпечатков
+
+// Поля задачи, которые сравниваются (битовая маска)
+enum TaskDiffField : unsigned {
+    DiffColumn = 1u << 0,
+    DiffTitle = 1u << 1,
+    DiffDescription = 1u << 2,
+    DiffPriority = 1u << 3,
+    DiffDeveloper = 1u << 4,
+};
+
+// Хеш содержимого задачи: заголовок, описание, приоритет и имя разработчика
+// Колонка в хеш не входит. Совпадение хешей считается совпадением полей
+// (вероятность случайного совпадения 64-битных хешей пренебрежимо мала)
+std::uint64_t task_content_hash(const Task& task);
+
+// Отпечаток доски: задачи с хешами содержимого и колонки, по возрастанию ID
+// Отпечаток ссылается на задачи доски и действителен, пока доска не меняется
+class BoardDigest {
+public:
+    struct Entry {
+        TaskId id;
+        std::uint64_t content;    // task_content_hash
+        std::uint64_t column;     // Хеш имени колонки
+        std::uint32_t position;   // Номер задачи в порядке обхода доски
+        const Task* task;
+    };
+
+private:
+    std::vector<Entry> entries;
+
+public:
+    explicit BoardDigest(const Board& board);
+
+    const std::vector<Entry>& get_entries() const { return entries; }
+};
+
+// Изменение одной задачи между двумя версиями доски
+struct TaskChange {
+    enum class Kind { Added, Removed, Changed };
+
+    Kind kind;
+    TaskId id;
+    unsigned fields = 0;            // Измененные поля (для Changed)
+    const Task* before = nullptr;   // Задача в старой версии (nullptr для Added)
+    const Task* after = nullptr;    // Задача в новой версии (nullptr для Removed)
+
+    bool moved() const { return (fields & DiffColumn) != 0; }
+    bool edited() const { return (fields & (DiffTitle | DiffDescription | DiffPriority)) != 0; }
+    bool reassigned() const { return (fields & DiffDeveloper) != 0; }
+};
+
+// Изменения задач от before к after: сначала добавленные и измененные
+// в порядке обхода after, затем удаленные в порядке обхода before
+std::vector<TaskChange> diff_boards(const Board& before, const Board& after);
+// То же по готовым отпечаткам (например, отпечаток базовой версии строится один раз)
+std::vector<TaskChange> diff_boards(const BoardDigest& before, const BoardDigest& after);
+
+// Конфликт слияния: обе стороны по-разному изменили одно и то же
+// В доске остается значение ours
+struct MergeConflict {
+    enum class Kind {
+        BothChanged,        // Поле field изменено по-разному (или задача добавлена обеими сторонами)
+        ChangedAndDeleted,  // Задача изменена в ours и удалена в theirs
+        DeletedAndChanged,  // Задача удалена в ours и изменена в theirs
+        Unsupported,        // Поле field изменено только в theirs, но его значение нельзя
+                            // установить в ours (сброс приоритета к значению по умолчанию)
+    };
+
+    Kind kind;
+    TaskId id;
+    unsigned field = 0;   // Поле конфликта (для BothChanged и Unsupported)
+    std::string ours;     // Значения сторон для вывода (для BothChanged и Unsupported)
+    std::string theirs;
+};
+
+// Итог слияния
+struct MergeResult {
+    std::size_t applied = 0;                // Изменений theirs, перенесенных в ours
+    std::vector<MergeConflict> conflicts;
+};
+
+// Трехстороннее слияние: изменения theirs относительно base переносятся в ours
+// Поле берется из theirs, если в ours оно не менялось; одинаковые изменения
+// конфликтом не считаются. ours меняется через обычные операции доски, поэтому
+// слушатель доски (журнал, автосохранение) видит каждое изменение
+// Недостающие в ours колонки и разработчики theirs добавляются по имени;
+// перемещенная задача попадает в конец колонки
+MergeResult merge_boards(const Board& base, Board& ours, const Board& theirs);
+// То же с готовым changes = diff_boards(base, theirs) - например, посчитанным в другом
+// потоке: тогда в потоке ours работа пропорциональна числу изменений
+MergeResult merge_boards(const Board& base, Board& ours, const Board& theirs,
+                         const std::vector<TaskChange>& changes);
+
+// Текстовое описание изменения и конфликта (одна строка, для CLI)
+std::string describe_change(const TaskChange& change);
+std::string describe_conflict(const MergeConflict& conflict);
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+#include "board_listener.h"
+#include "json_worker.h"
+
+class Board;
+
+// Класс BoardJournal - журнал изменений доски с упреждающей записью
+// Рядом со снимком доски (обычный JSON файл) лежит файл "<снимок>.journal":
+// по одной JSON строке на каждое изменение (создание, перемещение, удаление задачи,
+// смена ее полей, добавление и удаление разработчиков и колонок)
+// Запись идет в момент изменения, поэтому сохранение стоит O(изменений), а не O(доски)
+// Периодическое сжатие (compact) пишет полный снимок и начинает журнал заново
+//
+// Первая строка журнала - заголовок с размером и хешем снимка, к которому он относится
+// Если процесс упал между заменой снимка и заменой журнала, старый журнал
+// не совпадет с новым снимком по хешу и не будет применен повторно
+class BoardJournal : public BoardListener {
+public:
+    // Число записей, после которого sync() выполняет сжатие
+    static constexpr std::size_t default_compact_threshold = 10000;
+
+private:
+    std::string snapshot_path;  // Файл снимка доски
+    std::string journal_path;   // Файл журнала
+    // Запись снимков при сжатии; колонки, не менявшиеся с прошлого сжатия,
+    // берутся из кеша закодированных колонок
+    Json_worker snapshot_writer;
+    Board* board = nullptr;     // Доска, изменения которой записываются
+    std::unique_ptr<std::FILE, int (*)(std::FILE*)> file{nullptr, &std::fclose};
+    std::size_t record_count = 0;  // Записей в журнале после заголовка
+    std::size_t compact_threshold = default_compact_threshold;
+    rapidjson::StringBuffer line;  // Буфер текущей записи (переиспользуется)
+    rapidjson::Writer<rapidjson::StringBuffer> writer;
+
+    // Запись одной строки журнала: fill дописывает поля после "op"
+    template <typename F>
+    void append(const char* op, F&& fill);
+
+    // Заголовок нового журнала для снимка с указанным размером и хешем (во временном файле)
+    std::string write_header(std::uint64_t snapshot_size, std::uint64_t snapshot_hash);
+    void open_for_append();
+    std::size_t column_position(const Column* column) const;
+
+public:
+    explicit BoardJournal(std::string snapshot);
+    ~BoardJournal() override;
+
+    BoardJournal(const BoardJournal&) = delete;
+    BoardJournal& operator=(const BoardJournal&) = delete;
+
+    // Начало записи изменений доски: пишется свежий снимок и пустой журнал
+    void attach(Board& target);
+
+    // Восстановление после перезапуска: загрузка снимка, применение журнала
+    // и продолжение записи в тот же журнал. Возвращает число примененных записей
+    // Оборванная последняя строка (сбой во время записи) отбрасывается,
+    // поврежденная запись в середине журнала - BoardLoadError со смещением
+    std::size_t recover(Board& target);
+
+    // Отключение от доски; журнал на диске остается
+    void detach();
+
+    // Полный снимок доски и пустой журнал
+    void compact();
+
+    // Сброс журнала на диск (fsync); при достижении порога - сжатие
+    void sync();
+
+    std::size_t get_record_count() const { return record_count; }
+    void set_compact_threshold(std::size_t records) { compact_threshold = records; }
+    const std::string& get_journal_path() const { return journal_path; }
+    const std::string& get_snapshot_path() const { return snapshot_path; }
+
+    // События доски
+    void on_board_renamed(const Board& b) override;
+    void on_column_added(const Column& column) override;
+    void on_column_renamed(const Column& column) override;
+    void on_columns_cleared() override;
+    void on_developer_added(const Developer& developer) override;
+    void on_developer_renamed(const Developer& developer) override;
+    void on_developer_removed(std::size_t index) override;
+    void on_developers_cleared() override;
+    void on_task_added(const Task& task) override;
+    void on_task_moved(const Task& task) override;
+    void on_task_removed(const Task& task) override;
+    void on_task_changed(const Task& task, TaskField field) override;
+    void on_task_id_changed(const Task& task, TaskId old_id) override;
+    void on_board_replaced(const Board& b) override;
+};
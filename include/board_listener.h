@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstddef>
+#include "task_id.h"
+
+class Board;
+class Column;
+class Developer;
+class Task;
+
+// Поле задачи, об изменении которого сообщается слушателю
+enum class TaskField { Title, Description, Priority, Developer };
+
+// Класс BoardListener - наблюдатель за изменениями доски
+// События приходят после того, как изменение применено, поэтому слушатель видит новое состояние
+// Реализации по умолчанию пустые - наследник переопределяет только нужные события
+// Слушатель подключается через Board::set_listener и не принадлежит доске
+class BoardListener {
+public:
+    virtual ~BoardListener() = default;
+
+    virtual void on_board_renamed(const Board&) {}
+
+    // Колонка добавлена в конец списка колонок
+    // Ее задачи приходят следом отдельными on_task_added
+    virtual void on_column_added(const Column&) {}
+    virtual void on_column_renamed(const Column&) {}
+    virtual void on_columns_cleared() {}
+
+    virtual void on_developer_added(const Developer&) {}
+    virtual void on_developer_renamed(const Developer&) {}
+    // Разработчик удален; index - его позиция в списке разработчиков до удаления
+    virtual void on_developer_removed(std::size_t) {}
+    virtual void on_developers_cleared() {}
+
+    // Задача попала на доску (добавлена в колонку или пришла с другой доски)
+    virtual void on_task_added(const Task&) {}
+    // Задача перемещена в другую колонку той же доски (новая колонка - task.get_column())
+    virtual void on_task_moved(const Task&) {}
+    // Задача снята с доски; объект еще жив, но уже не принадлежит колонке
+    virtual void on_task_removed(const Task&) {}
+    virtual void on_task_changed(const Task&, TaskField) {}
+    virtual void on_task_id_changed(const Task&, TaskId) {}
+
+    // Содержимое доски целиком заменено загрузкой (отдельные события при этом не приходят)
+    virtual void on_board_replaced(const Board&) {}
+};
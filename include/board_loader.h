@@ -0,0 +1,156 @@
+#pragma once
+
+#include <exception>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+#include <rapidjson/reader.h>
+#include "board_arena.h"
+#include "column.h"
+#include "developer.h"
+#include "task.h"
+
+class Board;
+
+// Класс BoardLoadError - ошибка формата файла доски
+// Хранит смещение в байтах от начала файла, на котором разбор был прерван
+class BoardLoadError : public std::runtime_error {
+private:
+    std::size_t offset;
+
+public:
+    BoardLoadError(const std::string& message, std::size_t off)
+        : std::runtime_error(message + " at offset " + std::to_string(off)), offset(off) {}
+
+    std::size_t get_offset() const { return offset; }
+};
+
+// Структура BoardStage - доска, собранная загрузчиком, но еще не примененная
+// Живая доска не меняется, пока загрузка не завершилась успешно
+struct BoardStage {
+    // Арена объявлена первой, чтобы уничтожаться после объектов из нее
+    std::unique_ptr<BoardArena> arena;
+    std::string board_name;
+    std::vector<std::unique_ptr<Developer>> developers;
+    std::vector<std::unique_ptr<Column>> columns;
+    std::vector<TaskId> ids;  // Массив "ids" файла без повторов
+
+    // Замена содержимого доски собранными данными
+    // Название доски не меняется - как и раньше, его задает имя файла
+    void apply(Board& board);
+};
+
+// Класс BoardLoadHandler - SAX-обработчик rapidjson, который строит доску
+// прямо из потока токенов, без промежуточного DOM
+// В памяти держится только текущая задача: ее поля собираются до закрывающей
+// скобки, потому что порядок полей в объекте задачи не гарантирован
+// При разборе на месте (kParseInsituFlag) строки приходят с copy = false и живут
+// в буфере файла до конца разбора - тогда поля задачи хранятся как представления
+// и копируются один раз, сразу в строки Task
+// Структура файла проверяется в том же проходе: при нарушении обработчик запоминает
+// причину и прерывает разбор, а смещение берется из результата разбора
+class BoardLoadHandler : public rapidjson::BaseReaderHandler<rapidjson::UTF8<>, BoardLoadHandler> {
+private:
+    // Раздел объекта доски, внутри которого находится парсер
+    enum class Section { None, Ids, Developers, Column };
+
+    // Поле задачи, значение которого ожидается следующим
+    enum class Field { None, Description, Id, Priority, Developer };
+
+    // Поля текущей задачи
+    // Представления указывают либо в буфер разбора, либо в собственные строки *_storage
+    struct PendingTask {
+        std::string_view title;
+        std::string_view description;
+        std::string_view developer;
+        std::string title_storage;
+        std::string description_storage;
+        std::string developer_storage;
+        TaskId id;
+        int priority = -1;
+        bool has_description = false;
+        bool has_priority = false;
+        bool has_developer = false;
+    };
+
+    BoardStage& stage;
+    int depth = 0;             // Глубина вложенности текущего значения
+    int skip_depth = 0;        // > 0 - пропускается вложенное значение, которое загрузчику не нужно
+    bool board_found = false;  // Встречена ли первая доска
+    bool board_done = false;   // Первая доска прочитана, остальные пропускаются
+    bool ids_seen = false;
+    bool developers_seen = false;
+    bool has_content = false;  // У доски есть ids, developers или непустая колонка
+    Section section = Section::None;
+    Field field = Field::None;
+    std::string key;           // Последний ключ на уровне доски
+    Column* column = nullptr;  // Колонка, в которую сейчас добавляются задачи
+    PendingTask task;
+    bool in_task = false;
+
+    std::unordered_set<TaskId> seen_ids;
+    // Имя -> разработчик (при одинаковых именах - первый, как в индексе Board)
+    std::unordered_map<std::string_view, Developer*> developers_by_name;
+    // Задачи, встреченные раньше массива developers: назначаются в finish()
+    std::vector<std::pair<Task*, std::string>> deferred_developers;
+
+    // Колонки-объекты в порядке файла - для сопоставления с телами колонок
+    // при параллельной загрузке
+    std::vector<Column*> object_columns;
+
+    // Разбор фрагмента колонки при параллельной загрузке (см. конструктор фрагмента)
+    const BoardLoadHandler* skeleton = nullptr;
+    std::vector<std::unique_ptr<Task>>* fragment_tasks = nullptr;
+
+    std::exception_ptr error;  // Исключение из модели (например, неверный приоритет)
+    const char* structure_error = nullptr;  // Нарушение структуры файла
+
+    bool fail(const char* message);   // Прерывание разбора из-за структуры файла
+    bool scalar();                    // Скалярное значение в текущей позиции
+    bool start_container(bool is_object);
+    bool end_container();
+    bool finish_task();
+    Developer* find_developer(std::string_view name) const;
+
+public:
+    explicit BoardLoadHandler(BoardStage& s) : stage(s) {}
+
+    // Обработчик фрагмента колонки: разбирает объект, члены которого - задачи одной
+    // колонки, и складывает задачи в tasks, не добавляя их в колонку. Разработчики
+    // ищутся среди уже прочитанных обработчиком skeleton
+    // Обработчики фрагментов не меняют stage и общие данные, поэтому работают параллельно
+    BoardLoadHandler(BoardStage& s, const BoardLoadHandler& skeleton, std::vector<std::unique_ptr<Task>>& tasks)
+        : stage(s), depth(2), board_found(true), skeleton(&skeleton), fragment_tasks(&tasks) {}
+
+    bool Default() { return scalar(); }
+    bool Int(int value);
+    bool Uint(unsigned value);
+    bool String(const char* str, rapidjson::SizeType length, bool copy);
+    bool Key(const char* str, rapidjson::SizeType length, bool copy);
+    bool StartObject() { return start_container(true); }
+    bool EndObject(rapidjson::SizeType) { return end_container(); }
+    bool StartArray() { return start_container(false); }
+    bool EndArray(rapidjson::SizeType) { return end_container(); }
+
+    // Исключение, прервавшее разбор (nullptr если разбор прерван не обработчиком)
+    std::exception_ptr get_error() const { return error; }
+
+    // Нарушение структуры, прервавшее разбор (nullptr если структура верна)
+    const char* get_structure_error() const { return structure_error; }
+
+    // Завершение загрузки: назначение отложенных разработчиков
+    void finish();
+
+    // Колонки, значения которых в файле - объекты, в порядке файла
+    const std::vector<Column*>& get_object_columns() const { return object_columns; }
+
+    // Доска считается непустой, даже если ее колонки пришли без задач - для разбора
+    // файла, в котором задачи колонок разбираются отдельно
+    void assume_content() { has_content = true; }
+};
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "task_id.h"
+
+class Board;
+
+// Класс BoardSnapshot - копия содержимого доски на момент снятия
+// Снимается в потоке, который владеет доской (capture), и после этого не обращается
+// ни к доске, ни к реестрам разработчиков, поэтому записывать его можно из другого потока
+// Хранит ровно то, что пишет Json_worker::board_save, в том же порядке
+// Байты всех строк лежат подряд в одном буфере: снятие копии - это копирование байт,
+// а не выделение памяти под каждую строку
+class BoardSnapshot {
+public:
+    static constexpr uint32_t no_developer = UINT32_MAX;
+
+    // Ссылка на строку в буфере text
+    struct Text {
+        std::size_t offset;
+        std::size_t length;
+    };
+
+    struct TaskRecord {
+        TaskId id;
+        Text title;
+        Text description;
+        int priority;
+        uint32_t developer;  // Номер в developer_names или no_developer
+    };
+
+    struct ColumnRecord {
+        Text name;
+        std::size_t first_task;  // Задачи колонки - tasks[first_task, first_task + task_count)
+        std::size_t task_count;
+    };
+
+    Text name;
+    // Имена разработчиков: первые developer_count - разработчики доски в ее порядке,
+    // дальше - назначенные на задачи разработчики, которых на доске нет
+    std::vector<Text> developer_names;
+    std::size_t developer_count = 0;
+    std::vector<ColumnRecord> columns;
+    std::vector<TaskRecord> tasks;  // Задачи всех колонок по порядку
+    std::string text;
+
+    std::string_view get(Text ref) const { return std::string_view(text).substr(ref.offset, ref.length); }
+
+    // Снятие копии доски; вызывается в потоке доски
+    static BoardSnapshot capture(const Board& board);
+
+private:
+    Text add(std::string_view value);
+};
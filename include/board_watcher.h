@@ -0,0 +1,94 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include "board_diff.h"
+
+class Board;
+
+// Класс BoardWatcher - подхват изменений файла доски, сделанных другим процессом
+// Наблюдатель следит за файлом (inotify на каталог файла, поэтому замена файла
+// переименованием тоже видна). Когда файл меняется и затем не меняется settle,
+// поток наблюдателя разбирает его в отдельную доску и сравнивает с прошлой версией
+// файла (diff_boards). В поток доски (через executor) передаются только найденные
+// изменения: там они сливаются в живую доску через merge_boards, где прошлая версия
+// файла - base, живая доска - ours, новая версия - theirs. Так несохраненные правки
+// живой доски не теряются. Работа в потоке доски пропорциональна числу изменений
+// Версия файла, записанная самим процессом (см. WrittenFiles), не сливается, а только
+// становится новой прошлой версией: ее правки в доске уже есть, а правки, сделанные
+// после сохранения, иначе выглядели бы конфликтом с ним
+//
+// Изменения попадают в доску обычными операциями, поэтому подключенный журнал или
+// автосохранение их записывают. Ошибка разбора (файл дописан не до конца, поврежден)
+// пропускается: версия файла остается прежней до следующего изменения
+// Версии файла создают и удаляют своих разработчиков в потоке наблюдателя (и в потоке
+// доски, если там освобождается последняя ссылка на версию) - общий DeveloperRegistry
+// для этого защищен mutex
+// Где inotify нет, время изменения и размер файла проверяются с периодом settle
+class BoardWatcher {
+public:
+    // Выполнение задачи в потоке, владеющем доской (например, ScreenInteractive::Post)
+    using Executor = std::function<void(std::function<void()>)>;
+    // Вызывается в потоке доски после слияния изменений файла
+    using Callback = std::function<void(const MergeResult&)>;
+
+    static constexpr std::chrono::milliseconds default_settle{100};
+
+private:
+    Board& board;
+    std::string path;
+    Executor executor;
+    Callback on_merged;
+    std::chrono::milliseconds settle;
+
+    // Последняя разобранная версия файла; исходная задается в конструкторе, дальше
+    // версия меняется только в потоке наблюдателя. Задачи слияния держат свои копии указателей
+    std::shared_ptr<const Board> base;
+
+    std::mutex mutex;
+    std::condition_variable wake;  // Остановка (без inotify)
+    bool stopping = false;
+    std::size_t version_count = 0; // Разобранных версий файла, включая исходную
+    std::string last_error;        // Ошибка последнего разбора (пусто при успехе)
+
+    int inotify_fd = -1;
+    int stop_pipe[2] = {-1, -1};   // Пробуждение потока из poll при остановке
+    // Последние увиденные время изменения и размер файла (без inotify)
+    std::filesystem::file_time_type seen_time{};
+    std::uintmax_t seen_size = 0;
+
+    // Отметка о жизни наблюдателя для задач, оставшихся в очереди executor после его удаления
+    std::shared_ptr<char> alive = std::make_shared<char>();
+    std::thread worker;
+
+    void run();            // Поток наблюдателя
+    bool wait_change();    // Ожидание изменения файла; false - остановка
+    void reload();         // Разбор файла и передача изменений в поток доски
+
+public:
+    // Начало наблюдения за file_path. Текущая версия файла разбирается здесь же, в потоке
+    // доски, и становится исходной: ее отличия от доски не переносятся, переносятся только
+    // последующие изменения файла
+    // executor выполняет слияние в потоке доски; без executor слияние идет в потоке
+    // наблюдателя - это допустимо, только если доска не меняется одновременно с ним
+    BoardWatcher(Board& target, std::string file_path, Executor run_on_board_thread = nullptr,
+                 Callback merged = nullptr, std::chrono::milliseconds settle_time = default_settle);
+
+    // Остановка потока; задачи слияния, еще не выполненные executor, отменяются
+    ~BoardWatcher();
+
+    BoardWatcher(const BoardWatcher&) = delete;
+    BoardWatcher& operator=(const BoardWatcher&) = delete;
+
+    const std::string& get_path() const { return path; }
+    std::size_t get_version_count();
+    std::string get_last_error();
+};
@@ -1,9 +1,16 @@
 #pragma once
 
+#include <cstdint>
 #include <vector>
 #include <string>
+#include <string_view>
 #include <memory>
+#include <memory_resource>
+#include <unordered_map>
+#include "board_arena.h"
+#include "board_listener.h"
 #include "task.h"
+#include "task_list.h"
 
 // Предварительные объявления для избежания циклических зависимостей
 // (когда два класса ссылаются друг на друга)
@@ -15,40 +22,104 @@ class Board;
 // Примеры колонок: "In Progress", "Done"
 class Column {
 private:
-    std::string name;  // Название колонки (например "In Progress")
-    std::vector<std::unique_ptr<Task>> tasks;  // Список задач в колонке
+    std::pmr::string name;  // Название колонки (например "In Progress")
+    TaskList tasks;  // Задачи колонки (slot map со стабильным порядком обхода)
+    
+    // Индекс заголовок -> задача для поиска за O(1) в среднем
+    // Ключи - представления строк title самих задач, поэтому при переименовании
+    // задача сначала убирается из индекса (см. Task::set_title)
+    // multimap допускает задачи с одинаковыми заголовками
+    // После пакетного добавления (add_tasks) индекс не ведется и строится по списку задач
+    // при первом поиске по заголовку: загрузка большой доски не платит за индекс,
+    // пока поиск по заголовку не понадобился
+    mutable std::unordered_multimap<std::string_view, Task*> title_index;
+    mutable bool titles_indexed = true;  // false - индекс заголовков еще не построен
+    
+    Board* board = nullptr;  // Доска, на которой находится колонка (устанавливает Board::add_column)
+    
+    // Ревизия содержимого: меняется при любом изменении колонки или ее задач,
+    // поэтому совпадение ревизий означает, что колонка с тех пор не менялась
+    std::uint64_t revision;
+    
+    // Отметка об изменении колонки (и доски, на которой она находится)
+    void touch();
+    
+    // Поддержка индекса заголовков (пока индекс не построен, ничего не делают)
+    void index_title(Task* task);
+    void unindex_title(Task* task);
+    void build_title_index() const;
+    
+    // Привязка и отвязка задачи от колонки
+    // update_board = false при перемещении внутри одной доски:
+    // ID и задача не меняются, поэтому индекс доски трогать не нужно
+    void attach_task(std::unique_ptr<Task> task, bool update_board);
+    std::unique_ptr<Task> detach_task(Task* task, bool update_board);
+    
+    // Task обновляет индексы при изменении своего заголовка и ID
+    void on_task_id_changed(Task* task, TaskId old_id);
+    void on_task_developer_changed(Task* task, DeveloperHandle old_developer);
+    void on_task_changed(Task* task, TaskField field);  // Сообщение слушателю доски
+    
+    friend class Task;
+    friend class Board;
+    friend void move_task(Column* start, Column* end, Task* task);
 
 public:
     // Конструктор колонки с обязательным названием
-    Column(std::string n) : name(n) {}
+    Column(std::string n);
+    
+    // Память под колонку выделяется из текущей арены (см. ArenaScope) или из кучи
+    static void* operator new(std::size_t size) { return arena_allocate(size); }
+    static void operator delete(void* ptr) noexcept { arena_deallocate(ptr); }
     
     // Методы для работы с задачами в колонке
     
     // Добавление задачи в колонку
     // Принимает unique_ptr для передачи владения задачей
+    // На доске ID задачи должен быть свободен, иначе std::invalid_argument
     void add_task(std::unique_ptr<Task> task);
     
-    // Удаление задачи по названию
-    // Ищет задачу по заголовку и удаляет ее из колонки
-    void delete_task(const std::string& task_title);
+    // Пакетное добавление задач в конец колонки в порядке вектора
+    // Индексы доски резервируются один раз, ревизия меняется один раз; слушатель доски
+    // получает on_task_added для каждой задачи, как при add_task
+    // Индекс заголовков откладывается до первого find_task
+    // Занятый или повторный ID - std::invalid_argument, колонка не меняется
+    void add_tasks(std::vector<std::unique_ptr<Task>> batch);
     
-    // Получение списка задач (неконстантная версия)
-    // Позволяет модифицировать задачи
-    std::vector<std::unique_ptr<Task>>& get_tasks();
+    // Извлечение задачи из колонки с передачей владения вызывающему
+    // Задача знает свой слот, поэтому извлечение работает за O(1)
+    // Используется при перемещении задачи в другую колонку
+    std::unique_ptr<Task> take_task(Task* task);
     
-    // Получение списка задач (константная версия)
-    // Используется когда не нужно изменять задачи
-    const std::vector<std::unique_ptr<Task>>& get_tasks() const;
+    // Удаление задачи по названию
+    // Ищет задачу по заголовку в индексе и удаляет ее из колонки
+    // При одинаковых заголовках удаляется та же задача, что вернет find_task
+    void delete_task(std::string_view task_title);
     
-    // Получение названия колонки
-    std::string get_name() const;
+    // Получение списка задач только для чтения
+    // Задачи добавляются и извлекаются только методами колонки: иначе индексы
+    // заголовков и доски и слушатель доски не узнают об изменении
+    const TaskList& get_tasks() const;
+    
+    // Получение названия колонки без копирования строки
+    std::string_view get_name() const;
     
     // Установка названия колонки
     void set_name(std::string n);
     
-    // Поиск задачи по заголовку в колонке
+    // Доска, на которой находится колонка (nullptr если колонка не добавлена на доску)
+    Board* get_board() const;
+    
+    // Ревизия содержимого колонки (см. Board::next_revision)
+    std::uint64_t get_revision() const { return revision; }
+    
+    // Поиск задачи по заголовку в колонке через индекс заголовков
     // Возвращает указатель на задачу или nullptr если не найдена
-    Task* find_task(const std::string& title) const;
+    // Если задач с таким заголовком несколько, возвращается одна из них - какая именно,
+    // не определено (не обязательно первая по порядку колонки). Чтобы выбрать
+    // конкретную задачу, используйте ID (Board::find_task)
+    // Первый поиск после add_tasks строит индекс заголовков за O(задач колонки)
+    Task* find_task(std::string_view title) const;
     
     // Оператор сравнения для проверки эквивалентности колонок
     // Сравнивает колонки по названию
@@ -60,9 +131,9 @@ public:
 // Функции для работы с задачами между колонками
 
 // Перемещение задачи между колонками
-// Берет задачу из start колонки и перемещает в end колонку
+// Берет задачу из start колонки и перемещает в end колонку за O(1)
 void move_task(Column* start, Column* end, Task* task);
 
 // Поиск задачи на всей доске по названию колонки и заголовку задачи
 // Удобная функция для быстрого доступа к задаче без ручного поиска по колонкам
-Task* search_task(Board& board, const std::string& col, const std::string& title);
\ No newline at end of file
+Task* search_task(Board& board, std::string_view col, std::string_view title);
\ No newline at end of file
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "task_list.h"
+
+class Column;
+class Task;
+
+// Класс ColumnViewport - окно прокрутки колонки: какие задачи колонки сейчас видны
+// Хранилище колонки - список, поэтому позиция задачи ищется обходом. Окно запоминает
+// итератор на первую видимую задачу вместе с ревизией колонки: пока колонка не меняется,
+// кадр стоит O(rows), а прокрутка на шаг - O(шага). После изменения колонки позиция
+// ищется заново от ближайшего конца колонки - один раз, а не в каждом кадре
+// Окно не хранит ссылку на колонку между вызовами, поэтому переживает ее удаление
+class ColumnViewport {
+private:
+    std::size_t offset = 0;   // Номер первой видимой задачи
+    std::size_t rows = 1;     // Видимых задач при последней отрисовке
+    // Запомненный итератор и его позиция; действительны для колонки anchor_column
+    // с ревизией anchor_revision (адрес колонки сравнивается, но не разыменовывается)
+    TaskList::const_iterator anchor;
+    std::size_t anchor_offset = 0;
+    const Column* anchor_column = nullptr;
+    std::uint64_t anchor_revision = 0;
+
+public:
+    // Задачи окна высотой visible_rows (не меньше одной); окно не выходит за конец колонки
+    std::vector<const Task*> visible_tasks(const Column& column, std::size_t visible_rows);
+
+    // Сдвиг окна на delta задач в колонке из task_count задач
+    // Возвращает false, если окно уже у края и не сдвинулось
+    bool scroll(std::ptrdiff_t delta, std::size_t task_count);
+
+    std::size_t get_offset() const { return offset; }
+    std::size_t get_rows() const { return rows; }
+};
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+class Board;
+
+// Класс Csv_worker - массовый импорт и экспорт задач доски в CSV/TSV
+// Одна запись - одна задача; первая запись - заголовок с именами полей
+//   column, title, id, priority, developer, description
+// Экспорт пишет все поля в этом порядке. Импорт принимает поля в любом порядке
+// (имена без учета регистра), обязательны column и title, незнакомые поля пропускаются
+// Пустой id - новый ID, пустой priority или -1 - приоритет по умолчанию,
+// пустой developer - задача без назначения
+// Кавычки - по RFC 4180 для обоих разделителей: поле в кавычках может содержать
+// разделитель и переводы строк, кавычка внутри удваивается
+class Csv_worker {
+private:
+    std::string path;
+    char delimiter;
+    unsigned threads = 1;        // Потоки для разбора при импорте (1 - последовательно)
+    bool create_missing = true;  // Создавать отсутствующие колонки и разработчиков
+
+public:
+    // Разделитель выбирается по расширению: ".tsv" - табуляция, иначе запятая
+    explicit Csv_worker(std::string file_path);
+    Csv_worker(std::string file_path, char delim) : path(std::move(file_path)), delimiter(delim) {}
+
+    void set_path(const std::string& file_path) { path = file_path; }
+    const std::string& get_path() const { return path; }
+    void set_delimiter(char delim) { delimiter = delim; }
+    char get_delimiter() const { return delimiter; }
+    // Импорт делит файл на части по границам записей и разбирает их на threads потоках
+    // Результат и ошибки совпадают с последовательным разбором. 0 - по числу ядер
+    void set_threads(unsigned count);
+    unsigned get_threads() const { return threads; }
+    // Без создания отсутствующие колонка или разработчик - ошибка импорта
+    void set_create_missing(bool create) { create_missing = create; }
+    bool get_create_missing() const { return create_missing; }
+
+    // Запись всех задач доски по колонкам через буфер постоянного размера:
+    // память не зависит от числа задач. Файл заменяется через временный файл
+    // и переименование. Возвращает число записанных задач
+    std::size_t board_export(const Board& board) const;
+
+    // Добавление задач файла в конец их колонок (как create_task, но пакетами:
+    // колонка и разработчик ищутся один раз на серию записей, а не на каждую задачу)
+    // Задача с ID, который уже есть на доске или выше в файле, получает новый ID
+    // Ошибка формата - BoardLoadError со смещением записи; ошибка модели (неверный
+    // приоритет) - как есть. Доска меняется только при успешном импорте
+    // Возвращает число добавленных задач
+    std::size_t board_import(Board& board) const;
+};
@@ -1,20 +1,49 @@
 #pragma once
 
+#include <memory_resource>
 #include <string>
+#include <string_view>
+#include "board_arena.h"
+#include "developer_registry.h"
+
+class Board;
 
 // Класс Developer представляет разработчика в команде
 // Содержит базовую информацию о разработчике
 class Developer {
 private:
-    std::string name;  // Имя разработчика
+    std::pmr::string name;  // Имя разработчика
+    Board* board = nullptr;  // Доска разработчика - ее индекс имен обновляется при переименовании
+    DeveloperHandle handle;  // Ссылка на разработчика в DeveloperRegistry
+    
+    friend class Board;
+    
+    // Замена имени с обновлением индекса имен и уведомлением доски
+    void assign_name(std::string_view n);
     
 public:
     // Конструктор с обязательным именем
     // Использует список инициализации для эффективной инициализации
-    Developer(std::string n) : name(n) {}
+    // Разработчик регистрируется в DeveloperRegistry и получает handle
+    Developer(std::string n) : name(n, ArenaScope::resource()), handle(DeveloperRegistry::instance().add(this)) {}
+    
+    // После уничтожения все handle на разработчика становятся устаревшими
+    ~Developer() { DeveloperRegistry::instance().remove(handle); }
+    
+    // Копия - это другой разработчик с собственным handle
+    // Присваивание копирует только имя (как set_name): handle и доска остаются своими
+    Developer(const Developer& other) : name(other.name), handle(DeveloperRegistry::instance().add(this)) {}
+    Developer& operator=(const Developer& other);
+    
+    // Память под разработчика выделяется из текущей арены (см. ArenaScope) или из кучи
+    static void* operator new(std::size_t size) { return arena_allocate(size); }
+    static void operator delete(void* ptr) noexcept { arena_deallocate(ptr); }
+    
+    // Handle для компактных ссылок из задач
+    DeveloperHandle get_handle() const { return handle; }
     
-    // Получение имени разработчика
-    std::string get_name() const;
+    // Получение имени разработчика без копирования строки
+    std::string_view get_name() const;
     
     // Установка имени разработчика
     void set_name(std::string n);
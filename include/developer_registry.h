@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <shared_mutex>
+#include <vector>
+
+class Developer;
+
+// Компактная 32-битная ссылка на разработчика
+// Младшие 20 бит - номер слота в реестре, старшие 12 бит - поколение слота
+// Значение 0 означает "разработчик не назначен"
+class DeveloperHandle {
+public:
+    static constexpr uint32_t index_bits = 20;
+    static constexpr uint32_t index_mask = (1u << index_bits) - 1;
+    static constexpr uint32_t max_generation = (1u << (32 - index_bits)) - 1;
+
+private:
+    uint32_t value = 0;
+
+public:
+    DeveloperHandle() = default;
+    DeveloperHandle(uint32_t index, uint32_t generation)
+        : value((generation << index_bits) | (index & index_mask)) {}
+
+    uint32_t index() const { return value & index_mask; }
+    uint32_t generation() const { return value >> index_bits; }
+    uint32_t raw() const { return value; }
+    bool valid() const { return value != 0; }
+
+    bool operator==(const DeveloperHandle& other) const { return value == other.value; }
+    bool operator!=(const DeveloperHandle& other) const { return value != other.value; }
+};
+
+namespace std {
+template <>
+struct hash<DeveloperHandle> {
+    std::size_t operator()(const DeveloperHandle& handle) const noexcept {
+        return std::hash<uint32_t>()(handle.raw());
+    }
+};
+} // namespace std
+
+// Класс DeveloperRegistry - поколенческий slot map всех разработчиков процесса
+// Разработчик регистрируется при создании и снимается с учета при уничтожении,
+// поколение слота при этом увеличивается. Устаревший handle больше не совпадает
+// с поколением слота, поэтому проверка ссылки - O(1) без обхода задач
+// Слот, поколение которого дошло до max_generation, больше не выдается: иначе после
+// переполнения поколения старый handle снова совпал бы с новым разработчиком
+class DeveloperRegistry {
+private:
+    struct Slot {
+        Developer* developer = nullptr;  // Разработчик (nullptr если слот свободен)
+        uint32_t generation = 1;         // Текущее поколение слота (0 не используется)
+    };
+
+    std::vector<Slot> slots;           // Все слоты, включая свободные
+    std::vector<uint32_t> free_slots;  // Свободные слоты для повторного использования
+    std::size_t count = 0;             // Количество зарегистрированных разработчиков
+    mutable std::shared_mutex mutex;   // Запись - монопольно, чтение - совместно
+
+public:
+    // Общий реестр процесса
+    // Разработчики создаются и уничтожаются и вне потока доски (параллельная загрузка,
+    // импорт, слежение за файлом), поэтому все операции реестра защищены mutex
+    static DeveloperRegistry& instance();
+
+    // Регистрация разработчика, возвращает его handle
+    DeveloperHandle add(Developer* developer);
+
+    // Снятие с учета - все выданные handle на этот слот становятся устаревшими
+    void remove(DeveloperHandle handle);
+
+    // Разработчик по handle (nullptr если handle пуст или устарел)
+    Developer* get(DeveloperHandle handle) const;
+
+    std::size_t size() const;
+};
@@ -4,6 +4,12 @@
 #include <ftxui/component/screen_interactive.hpp>
 #include "board.h"
 #include "json_worker.h"
+#include "board_journal.h"
+#include "autosave_service.h"
+#include "board_watcher.h"
+#include "column_viewport.h"
+#include <chrono>
+#include <functional>
 #include <memory>
 #include <filesystem>
 
@@ -21,6 +27,21 @@ private:
     // Умный указатель на JSON worker для сохранения/загрузки
     std::shared_ptr<Json_worker> json_worker;
     
+    // Журнал изменений открытой доски (nullptr пока доска не сохранена и не загружена)
+    // Объявлен после board, чтобы отключаться от доски до ее уничтожения
+    std::unique_ptr<BoardJournal> journal;
+    
+    // Фоновое автосохранение (включается enable_autosave вместо журнала)
+    // Окно debounce 0 - автосохранение выключено
+    std::chrono::milliseconds autosave_delay{0};
+    std::unique_ptr<AutosaveService> autosave;
+    // Выполнение задачи в потоке UI (ScreenInteractive::Post), задается в run()
+    std::function<void(std::function<void()>)> post_to_ui;
+    
+    // Наблюдение за файлом открытой доски: изменения другого процесса сливаются в доску
+    // Объявлен после журнала и автосохранения, чтобы останавливаться раньше них
+    std::unique_ptr<BoardWatcher> watcher;
+    
     // Путь по умолчанию для сохранения досок
     std::string save_path = "../boards/board.json";
     
@@ -64,6 +85,12 @@ private:
     std::vector<std::string> task_titles;     // Форматированные названия задач
     std::vector<std::string> developer_names; // Имена разработчиков
     std::vector<std::string> json_files;      // Список JSON файлов в директории
+    
+    // Окна прокрутки колонок на вкладке доски (по позиции колонки) и области колонок
+    // на экране в прошлом кадре - по ним считается высота окна и попадание колесом мыши
+    std::vector<ColumnViewport> column_viewports;
+    std::vector<ftxui::Box> column_boxes;
+    int focused_board_column = 0;     // Колонка, которую прокручивают клавиши
 
     // Методы для внутренней логики UI
     
@@ -90,9 +117,17 @@ private:
     // Вызывает все отдельные методы обновления
     void refresh_ui_data();
     
+    // Запуск наблюдения за файлом save_path (после сохранения или загрузки доски)
+    void watch_board_file();
+    
     // Отрисовка визуального представления доски
-    // Создает графическое отображение колонок и задач
-    ftxui::Element render_board();
+    // Создает графическое отображение колонок и задач; элементы строятся только
+    // для задач, видимых в окнах колонок. focused - вкладка доски в фокусе
+    ftxui::Element render_board(bool focused);
+    
+    // Прокрутка колонок доски: стрелки влево/вправо выбирают колонку, вверх/вниз,
+    // PageUp/PageDown, Home/End и колесо мыши прокручивают ее. true - событие обработано
+    bool handle_board_event(ftxui::Event event);
     
     // Обработчики событий - вызываются при взаимодействии пользователя
     
@@ -117,7 +152,16 @@ private:
 
     ftxui::Component create_adaptive_button(const std::string& label, std::function<void()> on_click);
 
+    // Есть ли изменения доски, не записанные на диск (отмечаются "*" в заголовке)
+    bool has_unsaved_changes() const {
+        return autosave ? autosave->has_unsaved_changes() : board->has_unsaved_changes();
+    }
+
 public:
     ScrumBoardUI();  // Конструктор - инициализирует UI и данные
     void run();      // Основной метод запуска приложения
+    
+    // Включение фонового автосохранения: после сохранения или загрузки доска
+    // записывается в свой файл в отдельном потоке через debounce после изменений
+    void enable_autosave(std::chrono::milliseconds debounce) { autosave_delay = debounce; }
 };
\ No newline at end of file
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <random>
+#include <unordered_map>
+#include "task_id.h"
+
+// Класс IdAllocator выдает уникальные идентификаторы задач
+// Занятые ID хранятся в хеш-таблице, поэтому выделение и освобождение
+// работают за амортизированное O(1) независимо от размера доски
+class IdAllocator {
+private:
+    // Занятые ID и количество их владельцев
+    // Счетчик нужен, когда один ID временно принадлежит двум задачам
+    // (например, при перезагрузке доски из того же файла)
+    std::unordered_map<TaskId, uint32_t> used;
+    mutable std::mutex mutex;      // Защита реестра при работе из нескольких потоков
+
+    bool seeded = false;           // Задано ли фиксированное зерно
+    uint64_t seed = 0;             // Зерно для воспроизводимых запусков
+    uint64_t seed_epoch = 0;       // Версия зерна: потоки пересоздают генератор при ее смене
+
+    // Генератор случайных чисел текущего потока
+    // Создается один раз на поток, а не при каждом вызове
+    std::mt19937_64& generator();
+
+public:
+    // Длина ID по умолчанию - 6 символов base62
+    static constexpr std::size_t default_length = 6;
+
+    // Общий экземпляр аллокатора для всех задач процесса
+    static IdAllocator& instance();
+
+    // Выделение нового уникального ID заданной длины
+    TaskId allocate(std::size_t length = default_length);
+
+    // Регистрация уже существующего ID (например, загруженного из файла)
+    void reserve(TaskId id);
+
+    // Место в таблице под extra новых ID заранее: загрузка большой доски
+    // регистрирует ID без перестроений таблицы по ходу
+    void prepare(std::size_t extra);
+
+    // Освобождение ID - после последнего release он снова может быть выдан
+    void release(TaskId id);
+
+    bool contains(TaskId id) const;
+    std::size_t size() const;
+
+    // Очистка реестра (сброс состояния или загрузка новой доски)
+    void clear();
+
+    // Фиксированное зерно делает последовательность ID воспроизводимой
+    void set_seed(uint64_t s);
+    void clear_seed();
+};
@@ -1,16 +1,38 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
 #include <vector>
 #include <string>
 #include <memory>
+#include <unordered_map>
 #include <rapidjson/document.h>
 #include <rapidjson/prettywriter.h>
 #include <rapidjson/stringbuffer.h>
+#include "task_id.h"
 
 using namespace rapidjson;
 
 // Предварительное объявление класса Board
 class Board;
+class BoardSnapshot;
+class Column;
+struct BoardStage;
+
+// Способ чтения файла доски при загрузке
+enum class LoadMode {
+    Stream,  // Блочное чтение через FileReadStream
+    Mapped   // Отображение файла в память и разбор на месте, без копий строк
+};
+
+// Колонка, закодированная в JSON при прошлом сохранении (см. Json_worker::set_column_cache)
+struct CachedColumn {
+    std::uint64_t revision = 0;  // Ревизия колонки, с которой закодированы байты
+    std::string ids;             // Элементы массива ids для задач колонки
+    std::string tasks;           // Объект задач колонки
+};
+using ColumnCache = std::unordered_map<const Column*, CachedColumn>;
 
 // Класс Json_worker отвечает за сериализацию и десериализацию
 // состояния Scrum доски в формат JSON
@@ -20,7 +42,18 @@ private:
     Document doc;                              // DOM-представление JSON документа
     Document::AllocatorType& allocator = doc.GetAllocator();  // Аллокатор для создания JSON значений
     std::string save_path;                     // Путь для сохранения/загрузки файла
-    std::vector<std::string> ids;              // Временное хранилище ID задач
+    std::vector<TaskId> ids;                   // Временное хранилище ID задач (упакованных)
+    bool ids_loaded = false;                   // ids заполнены последней загрузкой файла save_path
+    std::string loaded_board_name;             // Название доски в последнем загруженном файле
+    LoadMode load_mode = LoadMode::Mapped;     // Способ чтения файла при загрузке
+    unsigned threads = 1;                      // Потоки для сохранения и загрузки (1 - последовательно)
+    
+    // Последнее сохранение в save_path: доска, ее ревизия и вид вывода
+    const Board* saved_board = nullptr;
+    std::uint64_t saved_revision = 0;
+    bool saved_pretty = true;
+    bool column_cache_enabled = false;         // Переиспользовать байты неизмененных колонок
+    ColumnCache column_cache;
 
 public:
     // Конструктор с указанием пути к файлу
@@ -31,12 +64,52 @@ public:
     // Основные методы работы с JSON
     
     void save();                                      // Сохранение документа в файл
-    void set_save_path(const std::string& path) { save_path = path; }  // Установка пути
+    void set_save_path(const std::string& path) { save_path = path; ids_loaded = false; saved_board = nullptr; }  // Установка пути
     std::string get_save_path() const { return save_path; }            // Получение пути
-    Value ids_add(const std::vector<std::string>& id);  // Добавление ID в JSON
-    std::vector<std::string> ids_get();               // Получение ID из JSON
+    void set_load_mode(LoadMode mode) { load_mode = mode; }            // Установка способа чтения
+    LoadMode get_load_mode() const { return load_mode; }               // Получение способа чтения
+    // Параллельный режим: при сохранении колонки (большие - по частям) кодируются в свои
+    // буферы на threads потоках и склеиваются по порядку; при загрузке файл делится
+    // по телам колонок, и задачи колонок строятся параллельно. Вывод и загруженная доска
+    // совпадают с последовательным режимом; сохранение держит в памяти весь JSON доски,
+    // загрузка работает только в режиме LoadMode::Mapped. 0 - по числу ядер
+    void set_threads(unsigned count);
+    unsigned get_threads() const { return threads; }
+    Value ids_add(const std::vector<TaskId>& id);     // Добавление ID в JSON (в виде строк base62)
+    std::vector<TaskId> ids_get();                    // Получение ID из JSON (после board_load - без разбора)
     void board_add(const Board& board, Value ids);    // Добавление доски в JSON
-    void board_load(Board& board);                    // Загрузка доски из JSON
+    
+    // Загрузка доски из JSON за одно чтение и один разбор файла
+    // Структура файла проверяется в том же проходе; нарушение структуры или синтаксиса -
+    // BoardLoadError со смещением в байтах. Доска меняется только при успешной загрузке
+    void board_load(Board& board);
+    
+    // Название доски, записанное в последнем загруженном файле
+    // board_load его не применяет - название доски задает имя файла
+    const std::string& get_loaded_board_name() const { return loaded_board_name; }
+    
+    // Потоковое сохранение доски прямо в файл, без построения DOM
+    // Вывод совпадает с board_add + save байт в байт; compact (pretty = false) - без отступов
+    // Массив ids строится из ID всех задач доски в порядке обхода колонок
+    // Файл заменяется целиком: запись идет во временный файл, который затем переименовывается
+    // Если доска не менялась с прошлого сохранения этим же Json_worker (по ревизии доски)
+    // и файл на месте, ничего не пишется; возвращает false в этом случае
+    bool board_save(const Board& board, bool pretty = true);
+    // Кеш закодированных колонок: при повторных сохранениях колонки с той же ревизией
+    // пишутся готовыми байтами. Кеш держит в памяти JSON всех колонок доски
+    void set_column_cache(bool enabled) { column_cache_enabled = enabled; column_cache.clear(); }
+    // Сохранение снимка доски (см. BoardSnapshot) - вывод совпадает с board_save
+    // Не обращается к доске, поэтому вызывается из любого потока; данные сбрасываются
+    // на диск до замены файла
+    void snapshot_save(const BoardSnapshot& snapshot, bool pretty = true);
+    // Запись доски в открытый файл с текущей позиции - для файлов, где доска занимает
+    // только часть (см. BoardContainer); вывод тот же, что у board_save
+    static void board_write(std::FILE* file, const Board& board, bool pretty = true);
+    // Разбор доски из JSON в памяти, завершенного '\0'; буфер разбирается на месте и меняется
+    // Смещения в BoardLoadError считаются от base_offset - позиции буфера в файле
+    static void stage_load(char* data, std::size_t base_offset, BoardStage& stage);
     void clear_ids();                                 // Очистка временного хранилища ID
-    bool is_valid_board_file(const std::string& file_path) const;  // Проверка валидности файла
+    // Проверка валидности файла теми же правилами, что и board_load
+    // Для загрузки отдельная проверка не нужна - board_load проверяет файл сам
+    bool is_valid_board_file(const std::string& file_path) const;
 };
\ No newline at end of file
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// Класс MappedFile - файл, отображенный в память для разбора на месте (in-situ)
+// Отображение частное (MAP_PRIVATE): парсер может писать в буфер, а файл на диске
+// не меняется - копируются только страницы, в которые действительно идет запись
+// За последним байтом файла всегда есть '\0', которого требует InsituStringStream
+// Там, где отображение недоступно (Windows, пустой файл), файл читается в буфер
+class MappedFile {
+private:
+    char* data_ = nullptr;         // Начало данных файла
+    std::size_t size_ = 0;         // Размер файла в байтах
+    std::size_t mapped_size_ = 0;  // Размер отображения (0 если используется буфер)
+    std::vector<char> fallback;    // Буфер для чтения без отображения
+
+    void read_fallback(const std::string& path);
+
+public:
+    // Открытие и отображение файла; std::runtime_error если файл не открывается
+    explicit MappedFile(const std::string& path);
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    // Данные файла, завершенные '\0' (data()[size()] == '\0')
+    char* data() { return data_; }
+    const char* data() const { return data_; }
+    std::size_t size() const { return size_; }
+
+    // Отображен ли файл в память (false - прочитан в буфер)
+    bool is_mapped() const { return mapped_size_ != 0; }
+
+    // Возврат прочитанных страниц системе: при следующем обращении они снова
+    // читаются из файла. Только для отображений, в которые не было записи,
+    // иначе измененные страницы потеряются. Для буфера ничего не делает
+    void release_pages() const;
+};
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Выполнение job(index, worker) для index в [0, count) на threads потоках
+// Текущий поток тоже работает (worker 0); первое исключение пробрасывается после
+// завершения всех потоков
+template <typename F>
+void parallel_for(std::size_t count, unsigned threads, F&& job) {
+    std::atomic<std::size_t> next{0};
+    std::exception_ptr error;
+    std::mutex error_mutex;
+    auto work = [&](unsigned worker) {
+        for (std::size_t index; (index = next.fetch_add(1)) < count;) {
+            try {
+                job(index, worker);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(error_mutex);
+                if (!error) {
+                    error = std::current_exception();
+                }
+            }
+        }
+    };
+    std::vector<std::thread> pool;
+    unsigned pool_size = static_cast<unsigned>(std::min<std::size_t>(threads, count));
+    for (unsigned worker = 1; worker < pool_size; ++worker) {
+        pool.emplace_back(work, worker);
+    }
+    work(0);
+    for (auto& thread : pool) {
+        thread.join();
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
@@ -1,69 +1,105 @@
 #pragma once
 
+#include <memory_resource>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <memory>
+#include "board_arena.h"
 #include "developer.h"
+#include "task_id.h"
+#include "task_list.h"
 
 // Предварительное объявление класса Developer для избежания циклических зависимостей
 // Позволяет использовать указатель на Developer без включения всего заголовка
 class Developer;
+class Column;
+class MappedFile;
 
 // Класс Task представляет задачу в Scrum доске
 // Содержит всю информацию о задаче: описание, ID, заголовок, приоритет и разработчика
 class Task {
 private:
-    std::string description;  // Подробное описание задачи
-    std::string id;           // Уникальный идентификатор задачи (генерируется автоматически)
-    std::string title;        // Краткий заголовок задачи
+    // Строки берут память из арены доски, если задача создана внутри ArenaScope
+    std::pmr::string description;  // Подробное описание задачи
+    TaskId id;                // Уникальный идентификатор задачи (упакован в 64 бита)
+    std::pmr::string title;   // Краткий заголовок задачи
     int priority;             // Приоритет задачи от 0 до 10
-    Developer* developer;     // Указатель на разработчика, назначенного на задачу
-
-    // Вектор для хранения всех использованных ID задач
-    static std::vector<std::string> used_ids;
+    DeveloperHandle developer;  // Handle разработчика, назначенного на задачу (устаревает при его удалении)
+    Column* column = nullptr; // Колонка, в которой сейчас находится задача (nullptr если ни в какой)
+    uint32_t slot = TaskList::npos;  // Слот задачи в хранилище колонки
+    // Ленивое описание: представление в отображение файла доски вместо копии в description
+    // Задача держит отображение, пока описание не заменено через set_description
+    std::string_view lazy_description;
+    std::shared_ptr<const MappedFile> description_file;
     
-    // Метод для генерации случайной строки заданной длины
-    // Используется для создания уникальных идентификаторов
-    static std::string generate_random_string(int length);
+    // Column сама устанавливает column и slot при добавлении и извлечении задачи
+    friend class Column;
     
 public:
     // Конструктор задачи с обязательным заголовком
     // Автоматически генерирует уникальный ID
-    Task(std::string titl);
+    // Заголовок копируется один раз - сразу в строку задачи (в арене, если она активна)
+    Task(std::string_view titl);
+    
+    // Конструктор для восстановления задачи с известным ID (например, при загрузке)
+    // Не обращается к генератору случайных чисел
+    Task(std::string_view titl, TaskId restored_id);
+    
+    // При уничтожении задачи ее ID возвращается в IdAllocator
+    ~Task();
     
     // Разрешаем перемещение для эффективной работы с умными указателями
-    // Компилятор сгенерирует конструктор перемещения и оператор присваивания перемещением
-    Task(Task&& other) = default;
-    Task& operator=(Task&& other) = default;
+    // ID переходит к новому объекту, у исходного он сбрасывается,
+    // чтобы один и тот же ID не освобождался дважды
+    // Задачу, которая лежит в колонке, перемещать нельзя (std::logic_error): индексы
+    // колонки и доски ссылаются на ее заголовок и ID. Перенос между колонками - move_task
+    Task(Task&& other);
+    Task& operator=(Task&& other);
+    
+    // Память под задачу выделяется из текущей арены (см. ArenaScope) или из кучи
+    static void* operator new(std::size_t size) { return arena_allocate(size); }
+    static void operator delete(void* ptr) noexcept { arena_deallocate(ptr); }
     
     // Методы для работы с ID задач
     
     // Генерация уникального ID для задачи
-    // Гарантирует что все ID в системе уникальны
-    static std::string generate_id();
+    // Делегирует IdAllocator, который хранит занятые ID в хеш-таблице
+    static TaskId generate_id();
     
     // Очистка списка использованных ID
     // Полезно при загрузке новой доски или сбросе состояния
     static void clear_used_ids();
     
     // Методы доступа и модификации полей задачи
+    // Геттеры строк возвращают std::string_view на внутренние данные задачи
+    // без копирования; представление действительно до изменения поля
     
-    void set_description(std::string descript);
-    std::string get_description() const;
-    std::string get_id() const;
-    std::string get_title() const;
-    void set_title(std::string titl);
+    void set_description(std::string_view descript);
+    std::string_view get_description() const;
+    // Описание, которое остается в файле: байты читаются с диска при первом обращении
+    // к представлению get_description(). text должен указывать внутрь file
+    void set_lazy_description(std::string_view text, std::shared_ptr<const MappedFile> file);
+    bool has_lazy_description() const { return description_file != nullptr; }
+    std::string get_id() const;      // Текстовый ID в base62 (для JSON и UI)
+    TaskId get_task_id() const;      // Упакованный ID для сравнения и хеширования
+    std::string_view get_title() const;
+    void set_title(std::string_view titl);
     int get_priority() const;
     void set_priority(int p);
     void set_developer(Developer* develop);
+    // ID, занятый другой задачей той же доски, - std::invalid_argument
     void set_id(std::string new_id);
+    void set_id(TaskId new_id);
     Developer* get_developer() const;
+    DeveloperHandle get_developer_handle() const;  // Handle разработчика без обращения к реестру
+    Column* get_column() const;
     
     // Оператор сравнения для проверки эквивалентности задач
     // Сравнивает задачи по всем полям кроме указателя на разработчика
     bool operator==(const Task& other) const {
         return title == other.title && 
-               description == other.description && 
+               get_description() == other.get_description() && 
                id == other.id;
     }
 };
\ No newline at end of file
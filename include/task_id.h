@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+
+// Класс TaskId - упакованный 64-битный идентификатор задачи
+// Внутри программы ID сравниваются, хешируются и хранятся как одно машинное слово,
+// а текстовое представление base62 строится только на границе JSON/UI
+//
+// Формат значения:
+//   старшие 4 бита - длина строки base62 (1..10), младшие 60 бит - ее числовое значение
+//   старшие 4 бита = 0xF - "чужой" ID (не base62 или длиннее 10 символов),
+//   младшие 60 бит - номер строки во внутренней таблице таких ID
+//   значение 0 - отсутствующий ID
+class TaskId {
+private:
+    uint64_t value = 0;
+
+public:
+    // Максимальная длина ID, который помещается в 60 бит как число base62
+    static constexpr std::size_t max_packed_length = 10;
+
+    constexpr TaskId() = default;
+    explicit constexpr TaskId(uint64_t raw) : value(raw) {}
+
+    // Упаковка числа base62 заданной длины (используется IdAllocator)
+    static TaskId from_base62(uint64_t number, std::size_t length);
+
+    // Преобразование текстового ID в упакованный
+    // Строки base62 до 10 символов упаковываются без выделения памяти
+    static TaskId from_string(std::string_view text);
+
+    // Текстовое представление ID (для JSON и UI)
+    std::string to_string() const;
+
+    uint64_t raw() const { return value; }
+    bool valid() const { return value != 0; }
+
+    bool operator==(const TaskId& other) const { return value == other.value; }
+    bool operator!=(const TaskId& other) const { return value != other.value; }
+    bool operator<(const TaskId& other) const { return value < other.value; }
+};
+
+// Хеширование для использования TaskId как ключа в unordered-контейнерах
+namespace std {
+template <>
+struct hash<TaskId> {
+    std::size_t operator()(const TaskId& id) const noexcept {
+        // Перемешивание бит (splitmix64), чтобы соседние значения не попадали в соседние корзины
+        uint64_t x = id.raw();
+        x ^= x >> 30;
+        x *= 0xbf58476d1ce4e5b9ULL;
+        x ^= x >> 27;
+        x *= 0x94d049bb133111ebULL;
+        x ^= x >> 31;
+        return static_cast<std::size_t>(x);
+    }
+};
+} // namespace std
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+class Task;
+
+// Класс TaskList - хранилище задач колонки
+// Задачи лежат в слотах (slot map), а порядок задается двусвязным списком по номерам слотов
+// Каждая задача знает свой слот, поэтому удаление и перемещение работают за O(1),
+// а обход идет в стабильном порядке добавления
+class TaskList {
+public:
+    // Номер несуществующего слота (конец списка)
+    static constexpr uint32_t npos = UINT32_MAX;
+
+private:
+    struct Slot {
+        std::unique_ptr<Task> task;  // Задача (nullptr если слот свободен)
+        uint32_t prev = npos;        // Предыдущий слот в порядке обхода
+        uint32_t next = npos;        // Следующий слот в порядке обхода
+    };
+
+    std::vector<Slot> slots;           // Все слоты, включая свободные
+    std::vector<uint32_t> free_slots;  // Свободные слоты для повторного использования
+    uint32_t head = npos;              // Первый слот в порядке обхода
+    uint32_t tail = npos;              // Последний слот в порядке обхода
+    std::size_t count = 0;             // Количество задач
+
+public:
+    // Итератор обходит задачи в порядке списка
+    // Разыменование дает const std::unique_ptr<Task>& - как у прежнего вектора задач
+    class const_iterator {
+    private:
+        const TaskList* list = nullptr;
+        uint32_t slot = npos;
+
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = std::unique_ptr<Task>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const std::unique_ptr<Task>*;
+        using reference = const std::unique_ptr<Task>&;
+
+        const_iterator() = default;
+        const_iterator(const TaskList* l, uint32_t s) : list(l), slot(s) {}
+
+        reference operator*() const { return list->slots[slot].task; }
+        pointer operator->() const { return &list->slots[slot].task; }
+
+        const_iterator& operator++() {
+            slot = list->slots[slot].next;
+            return *this;
+        }
+        const_iterator operator++(int) {
+            const_iterator copy = *this;
+            ++*this;
+            return copy;
+        }
+        const_iterator& operator--() {
+            slot = slot == npos ? list->tail : list->slots[slot].prev;
+            return *this;
+        }
+        const_iterator operator--(int) {
+            const_iterator copy = *this;
+            --*this;
+            return copy;
+        }
+
+        bool operator==(const const_iterator& other) const { return slot == other.slot; }
+        bool operator!=(const const_iterator& other) const { return slot != other.slot; }
+    };
+    using iterator = const_iterator;
+
+    // Добавление задачи в конец, возвращает номер слота
+    uint32_t push_back(std::unique_ptr<Task> task);
+
+    // Резерв слотов под count задач сверх текущих (для пакетного добавления)
+    void reserve(std::size_t extra) { slots.reserve(count + extra); }
+
+    // Извлечение задачи из слота с передачей владения - O(1)
+    std::unique_ptr<Task> remove(uint32_t slot);
+
+    // Задача в слоте (nullptr если слот пуст или не существует)
+    Task* at_slot(uint32_t slot) const;
+
+    void clear();
+
+    const_iterator begin() const { return const_iterator(this, head); }
+    const_iterator end() const { return const_iterator(this, npos); }
+
+    std::size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+
+    const std::unique_ptr<Task>& front() const { return slots[head].task; }
+    const std::unique_ptr<Task>& back() const { return slots[tail].task; }
+
+    // Задача на позиции index в порядке обхода
+    // Работает за O(index): список не поддерживает произвольный доступ, поэтому
+    // цикл по nth(i) квадратичен - для последовательного доступа используйте итераторы
+    const std::unique_ptr<Task>& nth(std::size_t index) const;
+};
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Отпечаток версии файла: устройство, inode, размер и время изменения
+// Сохранение через временный файл и переименование дает каждой версии новый inode,
+// поэтому совпадение отпечатков означает ту же самую запись файла
+struct FileStamp {
+    std::uint64_t device = 0;
+    std::uint64_t inode = 0;
+    std::uint64_t size = 0;
+    std::int64_t modified = 0;  // Время изменения в наносекундах
+    bool exists = false;
+
+    // Отпечаток файла path (exists == false, если файла нет)
+    static FileStamp of(const std::string& path);
+
+    bool operator==(const FileStamp& other) const {
+        return exists == other.exists && device == other.device && inode == other.inode &&
+               size == other.size && modified == other.modified;
+    }
+    bool operator!=(const FileStamp& other) const { return !(*this == other); }
+};
+
+// Класс WrittenFiles - последние файлы досок, записанные этим процессом
+// Наблюдатель за файлом (BoardWatcher) по нему отличает собственное сохранение
+// приложения от изменения, сделанного другим процессом
+// Запись идет из разных потоков (автосохранение), поэтому список защищен mutex
+class WrittenFiles {
+private:
+    static constexpr std::size_t capacity = 64;  // Хранятся только последние записи
+
+    std::vector<FileStamp> stamps;  // Кольцевой буфер отпечатков
+    std::size_t next = 0;           // Позиция следующей записи в буфере
+    mutable std::mutex mutex;
+
+public:
+    // Общий список процесса
+    static WrittenFiles& instance();
+
+    // Отметка: файл path только что записан этим процессом
+    void record(const std::string& path);
+
+    // Записана ли эта версия файла этим процессом
+    bool contains(const FileStamp& stamp) const;
+};
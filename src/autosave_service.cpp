@@ -0,0 +1,183 @@
+#include "autosave_service.h"
+#include <algorithm>
+#include <exception>
+#include <utility>
+#include "board.h"
+#include "json_worker.h"
+
+// Подключение к доске и запуск потока сервиса
+AutosaveService::AutosaveService(Board& target, std::string save_path,
+                                 std::chrono::milliseconds debounce_window, Executor run_on_board_thread)
+    : board(target),
+      path(std::move(save_path)),
+      debounce(debounce_window),
+      executor(std::move(run_on_board_thread)) {
+    board.set_listener(this);
+    worker = std::thread(&AutosaveService::run, this);
+}
+
+// Задачи, еще стоящие в очереди executor, после удаления сервиса ничего не делают
+AutosaveService::~AutosaveService() {
+    alive.reset();
+    if (board.get_listener() == this) {
+        board.set_listener(nullptr);
+    }
+    flush();
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_one();
+    worker.join();
+}
+
+// Изменение доски (в потоке доски)
+// Поток сервиса будится только первым изменением после снимка: дальше он сам
+// проверяет время последнего изменения, когда истекает окно debounce
+void AutosaveService::changed() {
+    bool first;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        first = change_count == captured_count;
+        ++change_count;
+        last_change = std::chrono::steady_clock::now();
+    }
+    if (first) {
+        wake.notify_one();
+    }
+}
+
+// Снятие снимка доски (в потоке доски) и передача его потоку сервиса
+void AutosaveService::capture() {
+    std::uint64_t count;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        count = change_count;
+        if (count == captured_count) {
+            capture_requested = false;
+            return;
+        }
+    }
+    // Доску меняет только ее поток, а он сейчас здесь - копия согласована
+    std::unique_ptr<BoardSnapshot> snapshot;
+    try {
+        snapshot = std::make_unique<BoardSnapshot>(BoardSnapshot::capture(board));
+    } catch (const std::exception& e) {
+        std::lock_guard<std::mutex> lock(mutex);
+        capture_requested = false;
+        last_error = e.what();
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        captured_count = count;
+        pending = std::move(snapshot);
+        pending_count = count;
+        capture_requested = false;
+    }
+    wake.notify_one();
+}
+
+// Поток сервиса: ожидание паузы в изменениях, запрос снимка и запись файла
+void AutosaveService::run() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        if (pending) {
+            std::unique_ptr<BoardSnapshot> snapshot = std::move(pending);
+            std::uint64_t count = pending_count;
+            lock.unlock();
+            write(*snapshot, count);
+            snapshot.reset();
+            lock.lock();
+            continue;
+        }
+        if (stopping) {
+            return;
+        }
+        if (change_count != captured_count && !capture_requested) {
+            auto deadline = last_change + debounce;
+            if (std::chrono::steady_clock::now() < deadline) {
+                wake.wait_until(lock, deadline);
+                continue;
+            }
+            capture_requested = true;
+            lock.unlock();
+            if (executor) {
+                executor([this, token = std::weak_ptr<char>(alive)] {
+                    if (token.lock()) {
+                        capture();
+                    }
+                });
+            } else {
+                capture();
+            }
+            lock.lock();
+            continue;
+        }
+        wake.wait(lock);
+    }
+}
+
+// Запись снимка (в потоке сервиса)
+void AutosaveService::write(const BoardSnapshot& snapshot, std::uint64_t count) {
+    std::string error;
+    try {
+        Json_worker(path).snapshot_save(snapshot);
+    } catch (const std::exception& e) {
+        error = e.what();
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (error.empty()) {
+            saved_count = std::max(saved_count, count);
+            ++save_count;
+            last_error.clear();
+        } else {
+            failed_count = std::max(failed_count, count);
+            last_error = std::move(error);
+        }
+    }
+    saved.notify_all();
+}
+
+// Немедленное сохранение: снимок снимается сразу, запись - в потоке сервиса
+// Доска пишется и без изменений (например, сохранение в новый файл)
+void AutosaveService::save_now() {
+    changed();
+    capture();
+}
+
+// Сохранение с ожиданием записи
+bool AutosaveService::flush() {
+    std::uint64_t target;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        target = change_count;
+        if (saved_count >= target) {
+            return true;
+        }
+    }
+    capture();
+    std::unique_lock<std::mutex> lock(mutex);
+    // Снимок мог не сняться (ошибка capture) - тогда ждать нечего
+    if (captured_count < target) {
+        return false;
+    }
+    saved.wait(lock, [&] { return saved_count >= target || failed_count >= target; });
+    return saved_count >= target;
+}
+
+bool AutosaveService::has_unsaved_changes() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return change_count != saved_count;
+}
+
+std::size_t AutosaveService::get_save_count() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return save_count;
+}
+
+std::string AutosaveService::get_last_error() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return last_error;
+}
@@ -0,0 +1,409 @@
+#include "binary_worker.h"
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+#include "board.h"
+#include "board_loader.h"
+#include "column.h"
+#include "developer.h"
+#include "id_allocator.h"
+#include "json_worker.h"
+#include "task.h"
+#include "written_files.h"
+
+namespace {
+
+const char magic[8] = {'T', 'S', 'B', 'O', 'A', 'R', 'D', '\0'};
+constexpr uint32_t byte_order_mark = 0x01020304;
+constexpr uint64_t foreign_tag = 0xF;  // Старшие 4 бита "чужого" TaskId (см. task_id.h)
+
+constexpr uint64_t align8(uint64_t value) {
+    return (value + 7) & ~uint64_t(7);
+}
+
+// Является ли ID "чужим" (хранится во внутренней таблице, а не числом)
+bool is_foreign(TaskId id) {
+    return (id.raw() >> 60) == foreign_tag;
+}
+
+// Запись в файл с буфером и подсчетом позиции
+// Данные пишутся во временный файл "<путь>.tmp", который close() переименовывает в путь
+class BinaryOutput {
+private:
+    std::string path;
+    std::string temp_path;
+    std::unique_ptr<std::FILE, int (*)(std::FILE*)> file;
+    uint64_t position = 0;
+
+public:
+    explicit BinaryOutput(const std::string& p)
+        : path(p), temp_path(p + ".tmp"), file(std::fopen(temp_path.c_str(), "wb"), &std::fclose) {
+        if (!file) {
+            throw std::runtime_error("Cannot open file: " + path);
+        }
+        std::setvbuf(file.get(), nullptr, _IOFBF, 64 * 1024);
+    }
+
+    // Незавершенная запись не оставляет временный файл
+    ~BinaryOutput() {
+        if (file) {
+            file.reset();
+            std::remove(temp_path.c_str());
+        }
+    }
+
+    void write(const void* data, std::size_t size) {
+        if (size != 0 && std::fwrite(data, 1, size, file.get()) != size) {
+            throw std::runtime_error("Cannot write file: " + path);
+        }
+        position += size;
+    }
+
+    template <typename T>
+    void write(const T& record) {
+        write(&record, sizeof(T));
+    }
+
+    void pad_to(uint64_t offset) {
+        static const char zeros[8] = {};
+        write(zeros, static_cast<std::size_t>(offset - position));
+    }
+
+    void rewrite_header(const BinaryHeader& header) {
+        if (std::fseek(file.get(), 0, SEEK_SET) != 0) {
+            throw std::runtime_error("Cannot write file: " + path);
+        }
+        write(header);
+    }
+
+    void close() {
+        if (std::fclose(file.release()) != 0) {
+            std::remove(temp_path.c_str());
+            throw std::runtime_error("Cannot write file: " + path);
+        }
+        std::error_code error;
+        std::filesystem::rename(temp_path, path, error);
+        if (error) {
+            std::remove(temp_path.c_str());
+            throw std::runtime_error("Cannot write file: " + path);
+        }
+        WrittenFiles::instance().record(path);
+    }
+
+    uint64_t tell() const { return position; }
+};
+
+// Раздача смещений в таблице строк в порядке записи
+class StringAllocator {
+private:
+    uint64_t size = 0;
+
+public:
+    explicit StringAllocator(uint64_t start = 0) : size(start) {}
+
+    BinaryString add(std::string_view text) {
+        if (size + text.size() > std::numeric_limits<uint32_t>::max()) {
+            throw std::length_error("Board strings exceed 4 GiB binary limit");
+        }
+        BinaryString ref{static_cast<uint32_t>(size), static_cast<uint32_t>(text.size())};
+        size += text.size();
+        return ref;
+    }
+
+    uint64_t get_size() const { return size; }
+};
+
+// Обход строк доски в порядке записи: название, колонки, разработчики, задачи
+// и в конце отдельным блоком описания задач
+// Оба прохода board_save используют этот обход, поэтому смещения совпадают с байтами
+template <typename F>
+void for_each_name(const Board& board, F&& emit) {
+    emit(board.get_name());
+    for (const auto& column : board.get_columns()) {
+        emit(column->get_name());
+    }
+    for (const auto& developer : board.get_developers()) {
+        emit(developer->get_name());
+    }
+    for (const auto& column : board.get_columns()) {
+        for (const auto& task : column->get_tasks()) {
+            TaskId id = task->get_task_id();
+            if (is_foreign(id)) {
+                emit(std::string_view(task->get_id()));
+            }
+            emit(task->get_title());
+        }
+    }
+}
+
+template <typename F>
+void for_each_description(const Board& board, F&& emit) {
+    for (const auto& column : board.get_columns()) {
+        for (const auto& task : column->get_tasks()) {
+            emit(task->get_description());
+        }
+    }
+}
+
+} // namespace
+
+// Открытие двоичного снимка
+BinaryBoardView::BinaryBoardView(const std::string& path) : file(std::make_shared<MappedFile>(path)) {
+    if (file->size() < sizeof(BinaryHeader)) {
+        throw BoardLoadError("Binary board file is truncated", file->size());
+    }
+    header = reinterpret_cast<const BinaryHeader*>(file->data());
+    validate();
+    uint64_t offset = sizeof(BinaryHeader);
+    columns = reinterpret_cast<const BinaryColumn*>(file->data() + offset);
+    offset = align8(offset + header->column_count * sizeof(BinaryColumn));
+    developers = reinterpret_cast<const BinaryDeveloper*>(file->data() + offset);
+    offset = align8(offset + header->developer_count * sizeof(BinaryDeveloper));
+    tasks = reinterpret_cast<const BinaryTask*>(file->data() + offset);
+    strings = file->data() + header->strings_offset;
+
+    // Ссылки записей проверяются один раз, чтобы аксессоры работали без проверок
+    auto check_string = [&](BinaryString ref, const void* record) {
+        if (uint64_t(ref.offset) + ref.length > header->strings_size) {
+            throw BoardLoadError("String reference out of range",
+                                 static_cast<std::size_t>(static_cast<const char*>(record) - file->data()));
+        }
+    };
+    check_string(header->board_name, header);
+    uint64_t next_task = 0;
+    for (std::size_t i = 0; i < column_count(); ++i) {
+        check_string(columns[i].name, &columns[i]);
+        if (columns[i].first_task != next_task || columns[i].task_count > header->task_count - next_task) {
+            throw BoardLoadError("Column task range out of order", static_cast<std::size_t>(
+                reinterpret_cast<const char*>(&columns[i]) - file->data()));
+        }
+        next_task += columns[i].task_count;
+    }
+    if (next_task != header->task_count) {
+        throw BoardLoadError("Tasks do not belong to columns", sizeof(BinaryHeader));
+    }
+    for (std::size_t i = 0; i < developer_count(); ++i) {
+        check_string(developers[i].name, &developers[i]);
+    }
+    for (std::size_t i = 0; i < task_count(); ++i) {
+        const BinaryTask& task = tasks[i];
+        check_string(task.id_text, &task);
+        check_string(task.title, &task);
+        check_string(task.description, &task);
+        if (task.developer > header->developer_count) {
+            throw BoardLoadError("Developer reference out of range",
+                                 static_cast<std::size_t>(reinterpret_cast<const char*>(&task) - file->data()));
+        }
+    }
+}
+
+// Проверка заголовка и границ секций
+void BinaryBoardView::validate() const {
+    if (std::memcmp(header->magic, magic, sizeof(magic)) != 0) {
+        throw BoardLoadError("Not a binary board file", 0);
+    }
+    if (header->byte_order != byte_order_mark) {
+        throw BoardLoadError("Binary board file has foreign byte order", offsetof(BinaryHeader, byte_order));
+    }
+    if (header->version == 0 || header->version > current_version) {
+        throw BoardLoadError("Unsupported binary board version " + std::to_string(header->version),
+                             offsetof(BinaryHeader, version));
+    }
+    // Размеры секций проверяются с запасом против переполнения
+    const uint64_t size = file->size();
+    if (header->column_count > size / sizeof(BinaryColumn) ||
+        header->developer_count > size / sizeof(BinaryDeveloper) ||
+        header->task_count > size / sizeof(BinaryTask)) {
+        throw BoardLoadError("Binary board counts exceed file size", offsetof(BinaryHeader, column_count));
+    }
+    uint64_t end = align8(sizeof(BinaryHeader) + header->column_count * sizeof(BinaryColumn));
+    end = align8(end + header->developer_count * sizeof(BinaryDeveloper));
+    end = align8(end + header->task_count * sizeof(BinaryTask));
+    if (header->strings_offset != end || header->strings_size > size || end > size - header->strings_size) {
+        throw BoardLoadError("Binary board sections exceed file size", offsetof(BinaryHeader, strings_offset));
+    }
+}
+
+// ID задачи: упакованный берется как есть, "чужой" - из таблицы строк
+TaskId BinaryBoardView::task_id(std::size_t task) const {
+    const BinaryTask& record = tasks[task];
+    if (record.id_text.length != 0) {
+        return TaskId::from_string(text(record.id_text));
+    }
+    return TaskId(record.id);
+}
+
+// Проверка сигнатуры файла
+bool BinaryBoardView::is_binary_file(const std::string& path) {
+    std::unique_ptr<std::FILE, int (*)(std::FILE*)> file(std::fopen(path.c_str(), "rb"), &std::fclose);
+    char signature[sizeof(magic)];
+    return file && std::fread(signature, 1, sizeof(signature), file.get()) == sizeof(signature) &&
+           std::memcmp(signature, magic, sizeof(magic)) == 0;
+}
+
+// Сохранение доски в двоичном формате
+void Binary_worker::board_save(const Board& board) {
+    BinaryHeader header{};
+    std::memcpy(header.magic, magic, sizeof(magic));
+    header.version = BinaryBoardView::current_version;
+    header.byte_order = byte_order_mark;
+    header.column_count = board.get_columns().size();
+    header.developer_count = board.get_developers().size();
+    for (const auto& column : board.get_columns()) {
+        header.task_count += column->get_tasks().size();
+    }
+
+    // Номера разработчиков для ссылок из задач
+    std::unordered_map<DeveloperHandle, uint32_t> developer_numbers;
+    developer_numbers.reserve(board.get_developers().size());
+    for (const auto& developer : board.get_developers()) {
+        developer_numbers.emplace(developer->get_handle(), static_cast<uint32_t>(developer_numbers.size() + 1));
+    }
+
+    // Описания идут после всех остальных строк, поэтому их смещения начинаются
+    // с суммарной длины остальных строк
+    uint64_t names_size = 0;
+    for_each_name(board, [&](std::string_view text) { names_size += text.size(); });
+
+    BinaryOutput out(save_path);
+    StringAllocator strings;
+    StringAllocator descriptions(names_size);
+    header.board_name = strings.add(board.get_name());
+    out.write(header);
+
+    // Первый проход: записи фиксированной длины со смещениями строк
+    uint64_t first_task = 0;
+    for (const auto& column : board.get_columns()) {
+        BinaryColumn record{strings.add(column->get_name()), first_task, column->get_tasks().size()};
+        first_task += record.task_count;
+        out.write(record);
+    }
+    out.pad_to(align8(out.tell()));
+    for (const auto& developer : board.get_developers()) {
+        out.write(BinaryDeveloper{strings.add(developer->get_name())});
+    }
+    out.pad_to(align8(out.tell()));
+    for (const auto& column : board.get_columns()) {
+        for (const auto& task : column->get_tasks()) {
+            BinaryTask record{};
+            TaskId id = task->get_task_id();
+            if (is_foreign(id)) {
+                record.id_text = strings.add(task->get_id());
+            } else {
+                record.id = id.raw();
+            }
+            record.title = strings.add(task->get_title());
+            record.description = descriptions.add(task->get_description());
+            record.priority = task->get_priority();
+            auto it = developer_numbers.find(task->get_developer_handle());
+            record.developer = it != developer_numbers.end() ? it->second : 0;
+            out.write(record);
+        }
+    }
+    out.pad_to(align8(out.tell()));
+    header.strings_offset = out.tell();
+    header.strings_size = descriptions.get_size();
+
+    // Второй проход: байты строк в том же порядке
+    auto write_text = [&](std::string_view text) { out.write(text.data(), text.size()); };
+    for_each_name(board, write_text);
+    for_each_description(board, write_text);
+
+    out.rewrite_header(header);
+    out.close();
+    std::cout << "Board saved successfully to: " << save_path << std::endl;
+}
+
+// Загрузка доски из двоичного файла
+void Binary_worker::board_load(Board& board) {
+    BinaryBoardView view(save_path);
+    // При ленивой загрузке задачи держат отображение файла; иначе оно закрывается вместе с view
+    std::shared_ptr<const MappedFile> file;
+    if (lazy_descriptions) {
+        file = view.get_file();
+    }
+
+    // Доска собирается отдельно и применяется только после успешного построения
+    BoardStage stage;
+    if (board.get_arena()) {
+        stage.arena = std::make_unique<BoardArena>();
+    }
+    {
+        ArenaScope arena_scope(stage.arena.get());
+        stage.board_name.assign(view.board_name());
+        stage.developers.reserve(view.developer_count());
+        for (std::size_t i = 0; i < view.developer_count(); ++i) {
+            stage.developers.push_back(std::make_unique<Developer>(std::string(view.developer_name(i))));
+        }
+        stage.ids.reserve(view.task_count());
+        stage.columns.reserve(view.column_count());
+        IdAllocator::instance().prepare(view.task_count());
+        for (std::size_t c = 0; c < view.column_count(); ++c) {
+            auto column = std::make_unique<Column>(std::string(view.column_name(c)));
+            std::size_t end = view.column_first_task(c) + view.column_task_count(c);
+            // Задачи колонки добавляются одним пакетом: индекс заголовков строится
+            // при первом поиске, а не при загрузке
+            std::vector<std::unique_ptr<Task>> batch;
+            batch.reserve(view.column_task_count(c));
+            for (std::size_t t = view.column_first_task(c); t < end; ++t) {
+                TaskId id = view.task_id(t);
+                auto task = std::make_unique<Task>(view.task_title(t), id);
+                std::string_view description = view.task_description(t);
+                if (!description.empty()) {
+                    if (lazy_descriptions) {
+                        task->set_lazy_description(description, file);
+                    } else {
+                        task->set_description(description);
+                    }
+                }
+                int priority = view.task_priority(t);
+                if (priority != -1) {
+                    task->set_priority(priority);
+                }
+                uint32_t developer = view.task_developer(t);
+                if (developer != BinaryBoardView::no_developer) {
+                    task->set_developer(stage.developers[developer].get());
+                }
+                stage.ids.push_back(id);
+                batch.push_back(std::move(task));
+            }
+            column->add_tasks(std::move(batch));
+            stage.columns.push_back(std::move(column));
+        }
+    }
+
+    // Записи и заголовки уже скопированы в модель: их страницы больше не нужны,
+    // в памяти остаются только описания, которые действительно читаются
+    if (file) {
+        file->release_pages();
+    }
+
+    loaded_board_name = std::move(stage.board_name);
+    stage.apply(board);
+    std::cout << "Board loaded successfully from file: " << save_path << std::endl;
+}
+
+// Преобразование JSON -> двоичный формат
+void Binary_worker::json_to_binary(const std::string& json_path, const std::string& binary_path) {
+    Board board("");
+    Json_worker reader(json_path);
+    reader.board_load(board);
+    board.set_name(reader.get_loaded_board_name());
+    Binary_worker(binary_path).board_save(board);
+}
+
+// Преобразование двоичного формата -> JSON
+void Binary_worker::binary_to_json(const std::string& binary_path, const std::string& json_path) {
+    Board board("");
+    Binary_worker reader(binary_path);
+    reader.board_load(board);
+    board.set_name(reader.get_loaded_board_name());
+    Json_worker(json_path).board_save(board);
+}
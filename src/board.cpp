@@ -1,3 +1,4 @@
+#include <atomic>
 #include <vector>
 #include <memory>
 #include <algorithm>
@@ -5,16 +6,69 @@
 #include "column.h"
 #include <stdexcept>
 
+// Следующая ревизия из общего счетчика
+// Счетчик атомарный: колонки могут собираться в нескольких потоках при загрузке
+std::uint64_t Board::next_revision() {
+    static std::atomic<std::uint64_t> counter{0};
+    return counter.fetch_add(1, std::memory_order_relaxed) + 1;
+}
+
+// Отметка колонок, в которых есть задачи разработчика
+void Board::touch_developer_columns(DeveloperHandle handle) {
+    auto it = developer_tasks.find(handle);
+    if (it == developer_tasks.end()) {
+        return;
+    }
+    for (Task* task : it->second) {
+        if (Column* column = task->get_column()) {
+            column->touch();
+        }
+    }
+}
+
 // Установка названия доски
 void Board::set_name(std::string n) {
     name = n;
+    touch();
+    if (listener) {
+        listener->on_board_renamed(*this);
+    }
 }
 
 // Получение названия доски
-std::string Board::get_name() const {
+std::string_view Board::get_name() const {
     return name;
 }
 
+// Включение режима арены
+void Board::enable_arena(std::size_t initial_size) {
+    if (!arena) {
+        arena = std::make_unique<BoardArena>(initial_size);
+    }
+}
+
+// Возврат всей памяти арены
+// Вместо освобождения каждого объекта и строки по отдельности
+// арена отдает системе только свои блоки
+void Board::release_arena() {
+    if (arena) {
+        arena->release();
+    }
+}
+
+// Замена арены доски
+// Объекты старой арены могут пережить доску (например, задача перенесена на другую
+// доску) - тогда старая арена не уничтожается, а переходит к новой дочерней
+void Board::replace_arena(std::unique_ptr<BoardArena> next) {
+    if (arena && arena->get_live_objects() != 0) {
+        if (!next) {
+            throw std::logic_error("Cannot replace arena with live objects");
+        }
+        next->adopt(std::move(arena));
+    }
+    arena = std::move(next);
+}
+
 // Получение списка колонок (неконстантная версия)
 // Возвращает ссылку для модификации колонок
 std::vector<std::unique_ptr<Column>>& Board::get_columns() {
@@ -33,14 +87,44 @@ void Board::add_column(std::unique_ptr<Column> col) {
     if (!col) {
         throw std::invalid_argument("Column cannot be null");
     }
+    // Колонка запоминает доску, а ее задачи попадают в индекс ID
+    // (при загрузке колонка заполняется задачами до добавления на доску)
+    // ID проверяются первыми: при повторе колонка не добавляется
+    task_index.reserve(task_index.size() + col->get_tasks().size());
+    index_task_ids(col->get_tasks());
+    attach_column(std::move(col));
+}
+
+// Привязка колонки, ID задач которой уже в индексе
+void Board::attach_column(std::unique_ptr<Column> col) {
+    col->board = this;
+    index_column(col.get());
+    for (const auto& task : col->get_tasks()) {
+        index_task_developer(task.get());
+    }
     // Перемещаем колонку в список колонок доски
+    Column* added = col.get();
     columns.push_back(std::move(col));
+    touch();
+    if (listener) {
+        listener->on_column_added(*added);
+        for (const auto& task : added->get_tasks()) {
+            listener->on_task_added(*task);
+        }
+    }
 }
 
 // Очистка всех колонок
 // Удаляет все колонки и их задачи
 void Board::clear_columns() {
+    task_index.clear();
+    developer_tasks.clear();
+    column_index.clear();
     columns.clear();
+    touch();
+    if (listener) {
+        listener->on_columns_cleared();
+    }
 }
 
 // Получение списка разработчиков (неконстантная версия)
@@ -61,41 +145,271 @@ void Board::add_developer(std::unique_ptr<Developer> develop) {
     if (!develop) {
         throw std::invalid_argument("Developer cannot be null");
     }
+    // Разработчик запоминает доску и попадает в индекс имен
+    develop->board = this;
+    index_developer(develop.get());
     // Перемещаем разработчика в список разработчиков доски
     developers.push_back(std::move(develop));
+    touch();
+    if (listener) {
+        listener->on_developer_added(*developers.back());
+    }
 }
 
 // Очистка списка разработчиков
 // Удаляет всех разработчиков с доски
+// Задачи хранят handle, которые устаревают вместе с разработчиками,
+// поэтому обходить задачи и снимать назначения не нужно
 void Board::clear_developers() {
+    // Назначенные задачи станут неназначенными - их колонки изменились
+    for (const auto& entry : developer_tasks) {
+        touch_developer_columns(entry.first);
+    }
+    developer_tasks.clear();
+    developer_index.clear();
     developers.clear();
+    touch();
+    if (listener) {
+        listener->on_developers_cleared();
+    }
 }
 
-// Поиск разработчика по имени
-Developer* Board::find_developer(const std::string& name) const {
-    // Используем алгоритм find_if для поиска по имени
-    // find_if проходит по всем разработчикам и проверяет условие
+// Удаление разработчика с доски
+void Board::delete_developer(Developer* develop) {
     auto it = std::find_if(developers.begin(), developers.end(),
-        // Лямбда-функция для сравнения имен разработчиков
         [&](const std::unique_ptr<Developer>& dev) {
-            return dev->get_name() == name;
+            return dev.get() == develop;
         });
+    if (it == developers.end()) {
+        throw std::runtime_error("Developer not found on board");
+    }
+    // Handle разработчика в задачах устареет при его уничтожении,
+    // поэтому достаточно убрать запись из обратного индекса
+    touch_developer_columns(develop->get_handle());
+    developer_tasks.erase(develop->get_handle());
+    unindex_developer(develop);
+    std::size_t index = static_cast<std::size_t>(it - developers.begin());
+    developers.erase(it);
+    touch();
+    if (listener) {
+        listener->on_developer_removed(index);
+    }
+}
+
+// Получение задач, назначенных на разработчика
+const std::unordered_set<Task*>& Board::get_developer_tasks(Developer* develop) const {
+    static const std::unordered_set<Task*> no_tasks;
+    if (!develop) {
+        return no_tasks;
+    }
+    auto it = developer_tasks.find(develop->get_handle());
+    return it != developer_tasks.end() ? it->second : no_tasks;
+}
+
+// Снятие разработчика со всех его задач
+void Board::unassign_developer(Developer* develop) {
+    reassign_developer(develop, nullptr);
+}
+
+// Передача всех задач разработчика другому (nullptr - снятие назначения)
+void Board::reassign_developer(Developer* from, Developer* to) {
+    if (!from || from == to) {
+        return;
+    }
+    auto it = developer_tasks.find(from->get_handle());
+    if (it == developer_tasks.end()) {
+        return;
+    }
+    // Забираем множество задач из индекса до изменения назначений,
+    // потому что set_developer сам обновляет индекс
+    std::unordered_set<Task*> tasks = std::move(it->second);
+    developer_tasks.erase(it);
+    for (Task* task : tasks) {
+        task->set_developer(to);
+    }
+}
+
+// Поиск разработчика по имени
+Developer* Board::find_developer(std::string_view name) const {
+    // Поиск в хеш-индексе имен - O(1) в среднем вместо прохода по всем разработчикам
+    auto it = developer_index.find(name);
     
     // Если разработчик найден, возвращаем указатель
     // Если не найден, возвращаем nullptr
-    return it != developers.end() ? it->get() : nullptr;
+    return it != developer_index.end() ? it->second : nullptr;
 }
 
 // Поиск колонки по имени
-Column* Board::find_column(const std::string& name) const {
-    // Используем алгоритм find_if для поиска по имени
-    auto it = std::find_if(columns.begin(), columns.end(),
-        // Лямбда-функция для сравнения имен колонок
-        [&](const std::unique_ptr<Column>& col) {
-            return col->get_name() == name;
-        });
+Column* Board::find_column(std::string_view name) const {
+    // Поиск в хеш-индексе имен колонок
+    auto it = column_index.find(name);
     
     // Если колонка найдена, возвращаем указатель
     // Если не найдена, возвращаем nullptr
-    return it != columns.end() ? it->get() : nullptr;
+    return it != column_index.end() ? it->second : nullptr;
+}
+
+// Добавление колонки в индекс имен (если имя еще не занято)
+void Board::index_column(Column* col) {
+    column_index.emplace(col->get_name(), col);
+}
+
+// Удаление колонки из индекса имен
+// Если есть другая колонка с тем же именем, индекс переходит к ней
+void Board::unindex_column(Column* col) {
+    auto it = column_index.find(col->get_name());
+    if (it == column_index.end() || it->second != col) {
+        return;
+    }
+    column_index.erase(it);
+    for (const auto& other : columns) {
+        if (other.get() != col && other->get_name() == col->get_name()) {
+            index_column(other.get());
+            break;
+        }
+    }
+}
+
+// Добавление разработчика в индекс имен (если имя еще не занято)
+void Board::index_developer(Developer* develop) {
+    developer_index.emplace(develop->get_name(), develop);
+}
+
+// Удаление разработчика из индекса имен
+// Если есть другой разработчик с тем же именем, индекс переходит к нему
+void Board::unindex_developer(Developer* develop) {
+    auto it = developer_index.find(develop->get_name());
+    if (it == developer_index.end() || it->second != develop) {
+        return;
+    }
+    developer_index.erase(it);
+    for (const auto& other : developers) {
+        if (other.get() != develop && other->get_name() == develop->get_name()) {
+            index_developer(other.get());
+            break;
+        }
+    }
+}
+
+// Добавление задачи в индексы доски
+void Board::index_task(Task* task) {
+    auto [it, inserted] = task_index.emplace(task->get_task_id(), task);
+    if (!inserted && it->second != task) {
+        throw std::invalid_argument("Task ID already exists: " + task->get_id());
+    }
+    index_task_developer(task);
+}
+
+// Добавление задачи в обратный индекс разработчиков
+void Board::index_task_developer(Task* task) {
+    if (task->get_developer()) {
+        developer_tasks[task->get_developer_handle()].insert(task);
+    }
+}
+
+namespace {
+
+// Добавление ID задач в индекс до первого повтора; при повторе индекс возвращается
+// к прежнему состоянию. Повтор внутри самих задач тоже считается занятым ID
+template <typename Tasks>
+void index_ids(std::unordered_map<TaskId, Task*>& index, const Tasks& tasks) {
+    for (auto it = tasks.begin(); it != tasks.end(); ++it) {
+        if (!index.emplace((*it)->get_task_id(), it->get()).second) {
+            for (auto added = tasks.begin(); added != it; ++added) {
+                index.erase((*added)->get_task_id());
+            }
+            throw std::invalid_argument("Task ID already exists: " + (*it)->get_id());
+        }
+    }
+}
+
+} // namespace
+
+void Board::index_task_ids(const TaskList& tasks) {
+    index_ids(task_index, tasks);
+}
+
+void Board::index_task_ids(const std::vector<std::unique_ptr<Task>>& tasks) {
+    index_ids(task_index, tasks);
+}
+
+// Колонки загруженной доски: индекс ID уже построен и проверен, колонок на доске нет
+void Board::add_indexed_columns(std::vector<std::unique_ptr<Column>> loaded, std::unordered_map<TaskId, Task*> index) {
+    task_index = std::move(index);
+    for (auto& col : loaded) {
+        attach_column(std::move(col));
+    }
+}
+
+// Удаление задачи из индексов доски
+// Запись ID удаляется только если она указывает именно на эту задачу
+void Board::unindex_task(Task* task) {
+    auto it = task_index.find(task->get_task_id());
+    if (it != task_index.end() && it->second == task) {
+        task_index.erase(it);
+    }
+    if (task->get_developer_handle().valid()) {
+        auto dev_it = developer_tasks.find(task->get_developer_handle());
+        if (dev_it != developer_tasks.end()) {
+            dev_it->second.erase(task);
+            if (dev_it->second.empty()) {
+                developer_tasks.erase(dev_it);
+            }
+        }
+    }
+}
+
+// Обновление обратного индекса после смены разработчика задачи
+void Board::on_developer_changed(Task* task, DeveloperHandle old_developer) {
+    if (old_developer.valid()) {
+        auto it = developer_tasks.find(old_developer);
+        if (it != developer_tasks.end()) {
+            it->second.erase(task);
+            if (it->second.empty()) {
+                developer_tasks.erase(it);
+            }
+        }
+    }
+    if (task->get_developer()) {
+        developer_tasks[task->get_developer_handle()].insert(task);
+    }
+}
+
+// Обновление индекса после смены ID задачи
+void Board::reindex_task(Task* task, TaskId old_id) {
+    auto it = task_index.find(old_id);
+    if (it != task_index.end() && it->second == task) {
+        task_index.erase(it);
+    }
+    index_task(task);
+}
+
+// Поиск задачи по ID
+Task* Board::find_task(TaskId id) const {
+    auto it = task_index.find(id);
+    return it != task_index.end() ? it->second : nullptr;
+}
+
+// Перемещение задачи по ID в указанную колонку
+void Board::move_task(TaskId id, Column* destination) {
+    Task* task = find_task(id);
+    if (!task) {
+        throw std::runtime_error("Task not found: " + id.to_string());
+    }
+    if (!destination) {
+        throw std::invalid_argument("Destination column cannot be null");
+    }
+    if (task->get_column() != destination) {
+        ::move_task(task->get_column(), destination, task);
+    }
+}
+
+// Удаление задачи по ID
+void Board::delete_task(TaskId id) {
+    Task* task = find_task(id);
+    if (!task) {
+        throw std::runtime_error("Task not found: " + id.to_string());
+    }
+    // Извлеченная задача уничтожается при выходе из области видимости
+    task->get_column()->take_task(task);
 }
\ No newline at end of file
@@ -0,0 +1,126 @@
+#include "board_arena.h"
+#include <new>
+#include <stdexcept>
+
+namespace {
+
+// Арена текущего потока
+thread_local BoardArena* current_arena = nullptr;
+
+// Заголовок перед объектом модели
+// Выровнен по max_align_t, чтобы сам объект остался выровненным
+struct alignas(alignof(std::max_align_t)) ObjectHeader {
+    BoardArena* arena;  // Арена объекта (nullptr если объект в куче)
+};
+
+} // namespace
+
+void* BoardArena::CountingResource::do_allocate(std::size_t size, std::size_t alignment) {
+    void* ptr = std::pmr::new_delete_resource()->allocate(size, alignment);
+    bytes += size;
+    ++blocks;
+    return ptr;
+}
+
+void BoardArena::CountingResource::do_deallocate(void* ptr, std::size_t size, std::size_t alignment) {
+    std::pmr::new_delete_resource()->deallocate(ptr, size, alignment);
+    bytes -= size;
+    --blocks;
+}
+
+BoardArena::BoardArena(std::size_t initial_size) : resource(initial_size, &upstream) {}
+
+// Выделение памяти под объект модели
+void* BoardArena::allocate_object(std::size_t size, std::size_t alignment) {
+    void* ptr = resource.allocate(size, alignment);
+    ++live_objects;
+    return ptr;
+}
+
+// Уничтожение объекта модели
+void BoardArena::deallocate_object() {
+    --live_objects;
+}
+
+// Возврат всех блоков арены
+void BoardArena::release() {
+    if (get_live_objects() != 0) {
+        throw std::logic_error("Cannot release arena with live objects");
+    }
+    resource.release();
+    children.clear();
+}
+
+// Передача дочерней арены
+void BoardArena::adopt(std::unique_ptr<BoardArena> child) {
+    if (child) {
+        children.push_back(std::move(child));
+    }
+}
+
+std::size_t BoardArena::get_live_objects() const {
+    std::size_t count = live_objects;
+    for (const auto& child : children) {
+        count += child->get_live_objects();
+    }
+    return count;
+}
+
+std::size_t BoardArena::get_reserved_bytes() const {
+    std::size_t bytes = upstream.bytes;
+    for (const auto& child : children) {
+        bytes += child->get_reserved_bytes();
+    }
+    return bytes;
+}
+
+std::size_t BoardArena::get_block_count() const {
+    std::size_t blocks = upstream.blocks;
+    for (const auto& child : children) {
+        blocks += child->get_block_count();
+    }
+    return blocks;
+}
+
+ArenaScope::ArenaScope(BoardArena* arena) : previous(current_arena) {
+    current_arena = arena;
+}
+
+ArenaScope::~ArenaScope() {
+    current_arena = previous;
+}
+
+BoardArena* ArenaScope::current() {
+    return current_arena;
+}
+
+std::pmr::memory_resource* ArenaScope::resource() {
+    return current_arena ? current_arena->get_resource() : std::pmr::get_default_resource();
+}
+
+// Выделение памяти под объект модели с заголовком
+void* arena_allocate(std::size_t size) {
+    std::size_t total = sizeof(ObjectHeader) + size;
+    void* block;
+    if (current_arena) {
+        block = current_arena->allocate_object(total, alignof(ObjectHeader));
+    } else {
+        block = ::operator new(total);
+    }
+    auto* header = static_cast<ObjectHeader*>(block);
+    header->arena = current_arena;
+    return header + 1;
+}
+
+// Освобождение памяти объекта модели
+void arena_deallocate(void* ptr) noexcept {
+    if (!ptr) {
+        return;
+    }
+    auto* header = static_cast<ObjectHeader*>(ptr) - 1;
+    if (header->arena) {
+        header->arena->deallocate_object();
+    } else {
+        ::operator delete(header);
+    }
+}
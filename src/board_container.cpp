@@ -0,0 +1,324 @@
+#include "board_container.h"
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include "board.h"
+#include "board_loader.h"
+#include "json_worker.h"
+#include "mapped_file.h"
+#if !defined(_WIN32)
+#include <unistd.h>
+#endif
+
+namespace {
+
+const char magic[8] = {'T', 'S', 'B', 'O', 'A', 'R', 'D', 'S'};
+constexpr uint32_t byte_order_mark = 0x01020304;
+
+using FilePtr = std::unique_ptr<std::FILE, int (*)(std::FILE*)>;
+
+// Позиция в файле без ограничения long в 2 ГиБ
+uint64_t tell(std::FILE* file) {
+#if defined(_WIN32)
+    return static_cast<uint64_t>(_ftelli64(file));
+#else
+    return static_cast<uint64_t>(ftello(file));
+#endif
+}
+
+bool seek(std::FILE* file, uint64_t offset) {
+#if defined(_WIN32)
+    return _fseeki64(file, static_cast<long long>(offset), SEEK_SET) == 0;
+#else
+    return fseeko(file, static_cast<off_t>(offset), SEEK_SET) == 0;
+#endif
+}
+
+// Сброс буфера и данных файла на диск
+bool sync(std::FILE* file) {
+    if (std::fflush(file) != 0 || std::ferror(file) != 0) {
+        return false;
+    }
+#if !defined(_WIN32)
+    return ::fsync(::fileno(file)) == 0;
+#else
+    return true;
+#endif
+}
+
+// Пустой контейнер: заголовок без досок, индекс сразу за ним
+ContainerHeader empty_header() {
+    ContainerHeader header{};
+    std::memcpy(header.magic, magic, sizeof(magic));
+    header.version = BoardContainer::current_version;
+    header.byte_order = byte_order_mark;
+    header.index_offset = sizeof(ContainerHeader);
+    return header;
+}
+
+} // namespace
+
+BoardContainer::BoardContainer(std::string container_path) : path(std::move(container_path)) {
+    read_index();
+}
+
+// Чтение и проверка заголовка и индекса
+void BoardContainer::read_index() {
+    FilePtr file(std::fopen(path.c_str(), "rb"), &std::fclose);
+    if (!file) {
+        if (std::filesystem::exists(path)) {
+            throw std::runtime_error("Cannot open file: " + path);
+        }
+        return;
+    }
+    file_exists = true;
+    const uint64_t size = std::filesystem::file_size(path);
+
+    ContainerHeader header{};
+    if (std::fread(&header, sizeof(header), 1, file.get()) != 1) {
+        throw BoardLoadError("Board container is truncated", static_cast<std::size_t>(size));
+    }
+    if (std::memcmp(header.magic, magic, sizeof(magic)) != 0) {
+        throw BoardLoadError("Not a board container file", 0);
+    }
+    if (header.byte_order != byte_order_mark) {
+        throw BoardLoadError("Board container has foreign byte order", offsetof(ContainerHeader, byte_order));
+    }
+    if (header.version == 0 || header.version > current_version) {
+        throw BoardLoadError("Unsupported board container version " + std::to_string(header.version),
+                             offsetof(ContainerHeader, version));
+    }
+    // Размеры проверяются с запасом против переполнения
+    if (header.index_offset < sizeof(ContainerHeader) || header.index_offset > size ||
+        header.board_count > (size - header.index_offset) / sizeof(ContainerEntry) ||
+        header.names_size > size - header.index_offset - header.board_count * sizeof(ContainerEntry)) {
+        throw BoardLoadError("Board container index exceeds file size", offsetof(ContainerHeader, index_offset));
+    }
+
+    std::vector<ContainerEntry> records(static_cast<std::size_t>(header.board_count));
+    std::string names(static_cast<std::size_t>(header.names_size), '\0');
+    if (!seek(file.get(), header.index_offset) ||
+        std::fread(records.data(), sizeof(ContainerEntry), records.size(), file.get()) != records.size() ||
+        std::fread(names.data(), 1, names.size(), file.get()) != names.size()) {
+        throw BoardLoadError("Board container index is truncated", static_cast<std::size_t>(header.index_offset));
+    }
+
+    entries.clear();
+    entries.reserve(records.size());
+    for (std::size_t i = 0; i < records.size(); ++i) {
+        const ContainerEntry& record = records[i];
+        const std::size_t record_offset = static_cast<std::size_t>(header.index_offset + i * sizeof(ContainerEntry));
+        // Сегмент вместе с '\0' лежит между заголовком и индексом
+        if (record.name.offset > names.size() || record.name.length > names.size() - record.name.offset ||
+            record.offset < sizeof(ContainerHeader) || record.offset > header.index_offset ||
+            record.size >= header.index_offset - record.offset) {
+            throw BoardLoadError("Board container entry out of range", record_offset);
+        }
+        entries.push_back({names.substr(record.name.offset, record.name.length), record.offset, record.size});
+    }
+    dead_bytes = header.dead_bytes;
+}
+
+const BoardContainer::Entry* BoardContainer::find(std::string_view name) const {
+    auto it = std::find_if(entries.begin(), entries.end(), [&](const Entry& entry) { return entry.name == name; });
+    return it != entries.end() ? &*it : nullptr;
+}
+
+// Имена досок в порядке индекса
+std::vector<std::string> BoardContainer::list() const {
+    std::vector<std::string> names;
+    names.reserve(entries.size());
+    for (const auto& entry : entries) {
+        names.push_back(entry.name);
+    }
+    return names;
+}
+
+// Загрузка доски: файл отображается в память, разбирается только сегмент доски
+// Страницы других досок не читаются
+void BoardContainer::board_load(std::string_view name, Board& board) {
+    const Entry* entry = find(name);
+    if (!entry) {
+        throw std::runtime_error("Board not found in container: " + std::string(name));
+    }
+    MappedFile file(path);
+    if (entry->offset + entry->size >= file.size() || file.data()[entry->offset + entry->size] != '\0') {
+        throw BoardLoadError("Board segment exceeds file size", static_cast<std::size_t>(entry->offset));
+    }
+
+    // Доска собирается отдельно и применяется только после успешного разбора
+    BoardStage stage;
+    if (board.get_arena()) {
+        stage.arena = std::make_unique<BoardArena>();
+    }
+    Json_worker::stage_load(file.data() + entry->offset, static_cast<std::size_t>(entry->offset), stage);
+    std::string board_name = entry->name;
+    stage.apply(board);
+    board.set_name(board_name);
+
+    std::cout << "Board " << board_name << " loaded successfully from container: " << path << std::endl;
+}
+
+// Запись индекса в конец файла и переключение заголовка
+// Заголовок пишется только после того, как сегменты и индекс сброшены на диск
+uint64_t BoardContainer::write_index(std::FILE* file, uint64_t end, const std::vector<Entry>& next) {
+    ContainerHeader header = empty_header();
+    header.index_offset = end;
+    header.board_count = next.size();
+
+    std::vector<ContainerEntry> records;
+    records.reserve(next.size());
+    uint64_t live = sizeof(ContainerHeader);
+    for (const auto& entry : next) {
+        if (header.names_size + entry.name.size() > std::numeric_limits<uint32_t>::max()) {
+            throw std::length_error("Board names exceed 4 GiB container limit");
+        }
+        records.push_back({entry.offset, entry.size,
+                           {static_cast<uint32_t>(header.names_size), static_cast<uint32_t>(entry.name.size())}});
+        header.names_size += entry.name.size();
+        live += entry.size + 1;
+    }
+    header.dead_bytes = end - live;
+
+    bool ok = seek(file, end) &&
+              std::fwrite(records.data(), sizeof(ContainerEntry), records.size(), file) == records.size();
+    for (const auto& entry : next) {
+        ok = ok && std::fwrite(entry.name.data(), 1, entry.name.size(), file) == entry.name.size();
+    }
+    ok = ok && sync(file) && seek(file, 0) && std::fwrite(&header, sizeof(header), 1, file) == 1 && sync(file);
+    if (!ok) {
+        throw std::runtime_error("Cannot write file: " + path);
+    }
+    return header.dead_bytes;
+}
+
+// Добавление или замена доски
+void BoardContainer::board_save(const Board& board, bool pretty) {
+    // Новый файл начинается с заголовка пустого контейнера
+    FilePtr file(std::fopen(path.c_str(), file_exists ? "r+b" : "w+b"), &std::fclose);
+    if (!file) {
+        throw std::runtime_error("Cannot open file for writing: " + path);
+    }
+    if (!file_exists) {
+        ContainerHeader header = empty_header();
+        if (std::fwrite(&header, sizeof(header), 1, file.get()) != 1 || !sync(file.get())) {
+            throw std::runtime_error("Cannot write file: " + path);
+        }
+        file_exists = true;
+    }
+
+    // Сегмент дописывается после всего, что есть в файле, включая старый индекс
+    if (std::fseek(file.get(), 0, SEEK_END) != 0) {
+        throw std::runtime_error("Cannot write file: " + path);
+    }
+    Entry entry{std::string(board.get_name()), tell(file.get()), 0};
+    Json_worker::board_write(file.get(), board, pretty);
+    if (std::fputc('\0', file.get()) == EOF) {
+        throw std::runtime_error("Cannot write file: " + path);
+    }
+    const uint64_t end = tell(file.get());
+    entry.size = end - entry.offset - 1;
+
+    std::vector<Entry> next = entries;
+    auto it = std::find_if(next.begin(), next.end(), [&](const Entry& e) { return e.name == entry.name; });
+    if (it != next.end()) {
+        *it = std::move(entry);
+    } else {
+        next.push_back(std::move(entry));
+    }
+    uint64_t dead = write_index(file.get(), end, next);
+    if (std::fclose(file.release()) != 0) {
+        throw std::runtime_error("Cannot write file: " + path);
+    }
+    entries = std::move(next);
+    dead_bytes = dead;
+
+    std::cout << "Board " << board.get_name() << " saved successfully to container: " << path << std::endl;
+}
+
+// Удаление доски из индекса
+void BoardContainer::board_remove(std::string_view name) {
+    if (!find(name)) {
+        throw std::runtime_error("Board not found in container: " + std::string(name));
+    }
+    FilePtr file(std::fopen(path.c_str(), "r+b"), &std::fclose);
+    if (!file || std::fseek(file.get(), 0, SEEK_END) != 0) {
+        throw std::runtime_error("Cannot open file for writing: " + path);
+    }
+    std::vector<Entry> next;
+    next.reserve(entries.size());
+    for (const auto& entry : entries) {
+        if (entry.name != name) {
+            next.push_back(entry);
+        }
+    }
+    uint64_t dead = write_index(file.get(), tell(file.get()), next);
+    if (std::fclose(file.release()) != 0) {
+        throw std::runtime_error("Cannot write file: " + path);
+    }
+    entries = std::move(next);
+    dead_bytes = dead;
+}
+
+// Перезапись контейнера без мертвых байт
+void BoardContainer::compact() {
+    if (!file_exists) {
+        return;
+    }
+    const std::string temp_path = path + ".tmp";
+    FilePtr source(std::fopen(path.c_str(), "rb"), &std::fclose);
+    FilePtr target(std::fopen(temp_path.c_str(), "w+b"), &std::fclose);
+    if (!source || !target) {
+        throw std::runtime_error("Cannot open file for writing: " + path);
+    }
+
+    // Сегменты копируются блоками подряд, в порядке индекса
+    ContainerHeader header = empty_header();
+    bool ok = std::fwrite(&header, sizeof(header), 1, target.get()) == 1;
+    std::vector<Entry> next = entries;
+    uint64_t end = sizeof(ContainerHeader);
+    std::vector<char> buffer(64 * 1024);
+    for (auto& entry : next) {
+        ok = ok && seek(source.get(), entry.offset);
+        uint64_t left = entry.size + 1;
+        while (ok && left > 0) {
+            std::size_t chunk = static_cast<std::size_t>(std::min<uint64_t>(left, buffer.size()));
+            ok = std::fread(buffer.data(), 1, chunk, source.get()) == chunk &&
+                 std::fwrite(buffer.data(), 1, chunk, target.get()) == chunk;
+            left -= chunk;
+        }
+        entry.offset = end;
+        end += entry.size + 1;
+    }
+
+    std::error_code error;
+    if (ok) {
+        try {
+            write_index(target.get(), end, next);
+        } catch (const std::runtime_error&) {
+            ok = false;
+        }
+    }
+    ok = std::fclose(target.release()) == 0 && ok;
+    if (ok) {
+        std::filesystem::rename(temp_path, path, error);
+    }
+    if (!ok || error) {
+        std::remove(temp_path.c_str());
+        throw std::runtime_error("Cannot write file: " + path);
+    }
+    entries = std::move(next);
+    dead_bytes = 0;
+}
+
+// Проверка сигнатуры файла
+bool BoardContainer::is_container_file(const std::string& path) {
+    FilePtr file(std::fopen(path.c_str(), "rb"), &std::fclose);
+    char signature[sizeof(magic)];
+    return file && std::fread(signature, 1, sizeof(signature), file.get()) == sizeof(signature) &&
+           std::memcmp(signature, magic, sizeof(magic)) == 0;
+}
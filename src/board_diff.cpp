@@ -0,0 +1,370 @@
+#include "board_diff.h"
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <string_view>
+#include "board.h"
+#include "column.h"
+#include "developer.h"
+#include "task.h"
+
+namespace {
+
+const TaskDiffField all_fields[] = {DiffColumn, DiffTitle, DiffDescription, DiffPriority, DiffDeveloper};
+
+// Смешивание хеша (splitmix64), чтобы порядок полей влиял на результат
+std::uint64_t mix(std::uint64_t x) {
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+    return x;
+}
+
+std::string_view column_name(const Task& task) {
+    return task.get_column() ? task.get_column()->get_name() : std::string_view();
+}
+
+// Имя разработчика задачи; пустое - без назначения (или разработчик удален)
+std::string_view developer_name(const Task& task) {
+    Developer* developer = task.get_developer();
+    return developer ? developer->get_name() : std::string_view();
+}
+
+// Поля, которыми различаются две версии задачи
+// Содержимое сравнивается по полям только при разных хешах
+unsigned differing_fields(const Task& a, const Task& b) {
+    unsigned fields = column_name(a) != column_name(b) ? DiffColumn : 0u;
+    if (task_content_hash(a) != task_content_hash(b)) {
+        if (a.get_title() != b.get_title()) {
+            fields |= DiffTitle;
+        }
+        if (a.get_description() != b.get_description()) {
+            fields |= DiffDescription;
+        }
+        if (a.get_priority() != b.get_priority()) {
+            fields |= DiffPriority;
+        }
+        if (developer_name(a) != developer_name(b)) {
+            fields |= DiffDeveloper;
+        }
+    }
+    return fields;
+}
+
+const char* field_name(unsigned field) {
+    switch (field) {
+        case DiffColumn: return "column";
+        case DiffTitle: return "title";
+        case DiffDescription: return "description";
+        case DiffPriority: return "priority";
+        case DiffDeveloper: return "developer";
+        default: return "task";
+    }
+}
+
+// Значение поля для вывода
+std::string field_value(const Task& task, unsigned field) {
+    switch (field) {
+        case DiffColumn: return std::string(column_name(task));
+        case DiffTitle: return std::string(task.get_title());
+        case DiffDescription: return std::string(task.get_description());
+        case DiffPriority: return std::to_string(task.get_priority());
+        case DiffDeveloper: return task.get_developer() ? std::string(developer_name(task)) : "Unassigned";
+        default: return std::string();
+    }
+}
+
+// Перенос изменений theirs в ours
+class Merger {
+private:
+    Board& ours;
+    MergeResult& result;
+
+    // Колонка и разработчик ours по имени; недостающие создаются
+    Column* column(std::string_view name) {
+        if (Column* existing = ours.find_column(name)) {
+            return existing;
+        }
+        ours.add_column(std::make_unique<Column>(std::string(name)));
+        return ours.get_columns().back().get();
+    }
+
+    Developer* developer(std::string_view name) {
+        if (name.empty()) {
+            return nullptr;
+        }
+        if (Developer* existing = ours.find_developer(name)) {
+            return existing;
+        }
+        ours.add_developer(std::make_unique<Developer>(std::string(name)));
+        return ours.get_developers().back().get();
+    }
+
+    void conflict(MergeConflict::Kind kind, TaskId id, unsigned field = 0, std::string ours_value = std::string(),
+                  std::string theirs_value = std::string()) {
+        result.conflicts.push_back({kind, id, field, std::move(ours_value), std::move(theirs_value)});
+    }
+
+    // Значение поля theirs в задаче ours; false - значение не переносится
+    bool apply(Task& task, const Task& theirs, unsigned field) {
+        switch (field) {
+            case DiffColumn:
+                ours.move_task(task.get_task_id(), column(column_name(theirs)));
+                return true;
+            case DiffTitle:
+                task.set_title(theirs.get_title());
+                return true;
+            case DiffDescription:
+                task.set_description(theirs.get_description());
+                return true;
+            case DiffPriority:
+                // Приоритет задачи нельзя вернуть к значению по умолчанию (-1)
+                if (theirs.get_priority() == -1) {
+                    return false;
+                }
+                task.set_priority(theirs.get_priority());
+                return true;
+            case DiffDeveloper:
+                task.set_developer(developer(developer_name(theirs)));
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    void added(const TaskChange& change) {
+        const Task& theirs = *change.after;
+        if (Task* existing = ours.find_task(change.id)) {
+            // Задача с этим ID добавлена обеими сторонами: отличающиеся поля - конфликты
+            unsigned fields = differing_fields(*existing, theirs);
+            for (unsigned field : all_fields) {
+                if (fields & field) {
+                    conflict(MergeConflict::Kind::BothChanged, change.id, field,
+                             field_value(*existing, field), field_value(theirs, field));
+                }
+            }
+            return;
+        }
+        auto task = std::make_unique<Task>(theirs.get_title(), change.id);
+        task->set_description(theirs.get_description());
+        if (theirs.get_priority() != -1) {
+            task->set_priority(theirs.get_priority());
+        }
+        task->set_developer(developer(developer_name(theirs)));
+        column(column_name(theirs))->add_task(std::move(task));
+        ++result.applied;
+    }
+
+    void removed(const TaskChange& change) {
+        Task* existing = ours.find_task(change.id);
+        if (!existing) {
+            return;  // Удалена обеими сторонами
+        }
+        if (differing_fields(*change.before, *existing) != 0) {
+            conflict(MergeConflict::Kind::ChangedAndDeleted, change.id);
+            return;
+        }
+        ours.delete_task(change.id);
+        ++result.applied;
+    }
+
+    void changed(const TaskChange& change) {
+        Task* existing = ours.find_task(change.id);
+        if (!existing) {
+            conflict(MergeConflict::Kind::DeletedAndChanged, change.id);
+            return;
+        }
+        const Task& theirs = *change.after;
+        unsigned ours_fields = differing_fields(*change.before, *existing);
+        bool applied = false;
+        for (unsigned field : all_fields) {
+            if (!(change.fields & field)) {
+                continue;
+            }
+            if (!(ours_fields & field)) {
+                if (apply(*existing, theirs, field)) {
+                    applied = true;
+                } else {
+                    // ours поле не трогал - это не одновременная правка, а неприменимое значение
+                    conflict(MergeConflict::Kind::Unsupported, change.id, field,
+                             field_value(*existing, field), field_value(theirs, field));
+                }
+                continue;
+            } else if (field_value(*existing, field) == field_value(theirs, field)) {
+                continue;  // Одинаковое изменение с обеих сторон
+            }
+            conflict(MergeConflict::Kind::BothChanged, change.id, field,
+                     field_value(*existing, field), field_value(theirs, field));
+        }
+        if (applied) {
+            ++result.applied;
+        }
+    }
+
+public:
+    Merger(Board& o, MergeResult& r) : ours(o), result(r) {}
+
+    void merge(const Board& base, const Board& theirs, const std::vector<TaskChange>& changes) {
+        // Колонки и разработчики, добавленные в theirs, - в порядке theirs
+        for (const auto& col : theirs.get_columns()) {
+            if (!base.find_column(col->get_name())) {
+                column(col->get_name());
+            }
+        }
+        for (const auto& dev : theirs.get_developers()) {
+            if (!base.find_developer(dev->get_name())) {
+                developer(dev->get_name());
+            }
+        }
+        for (const TaskChange& change : changes) {
+            switch (change.kind) {
+                case TaskChange::Kind::Added: added(change); break;
+                case TaskChange::Kind::Removed: removed(change); break;
+                case TaskChange::Kind::Changed: changed(change); break;
+            }
+        }
+    }
+};
+
+} // namespace
+
+// Хеш содержимого задачи
+std::uint64_t task_content_hash(const Task& task) {
+    std::hash<std::string_view> hash;
+    std::uint64_t h = mix(hash(task.get_title()));
+    h = mix(h ^ hash(task.get_description()));
+    h = mix(h ^ static_cast<std::uint64_t>(static_cast<unsigned>(task.get_priority())));
+    return mix(h ^ hash(developer_name(task)));
+}
+
+// Отпечаток доски
+BoardDigest::BoardDigest(const Board& board) {
+    std::hash<std::string_view> hash;
+    std::uint32_t position = 0;
+    for (const auto& column : board.get_columns()) {
+        std::uint64_t column_hash = mix(hash(column->get_name()));
+        entries.reserve(entries.size() + column->get_tasks().size());
+        for (const auto& task : column->get_tasks()) {
+            entries.push_back({task->get_task_id(), task_content_hash(*task), column_hash, position++, task.get()});
+        }
+    }
+    std::sort(entries.begin(), entries.end(),
+              [](const Entry& a, const Entry& b) { return a.id.raw() < b.id.raw(); });
+}
+
+// Изменения задач между версиями доски
+std::vector<TaskChange> diff_boards(const Board& before, const Board& after) {
+    return diff_boards(BoardDigest(before), BoardDigest(after));
+}
+
+// Слияние двух отпечатков по ID
+std::vector<TaskChange> diff_boards(const BoardDigest& before, const BoardDigest& after) {
+    const auto& old_entries = before.get_entries();
+    const auto& new_entries = after.get_entries();
+    // Изменение и номер задачи в порядке обхода ее доски - для сортировки вывода
+    std::vector<std::pair<std::uint32_t, TaskChange>> found;
+    std::vector<std::pair<std::uint32_t, TaskChange>> removed;
+    std::size_t i = 0, j = 0;
+    while (i < old_entries.size() || j < new_entries.size()) {
+        if (j == new_entries.size() || (i < old_entries.size() && old_entries[i].id.raw() < new_entries[j].id.raw())) {
+            const auto& entry = old_entries[i++];
+            removed.push_back({entry.position, {TaskChange::Kind::Removed, entry.id, 0, entry.task, nullptr}});
+        } else if (i == old_entries.size() || new_entries[j].id.raw() < old_entries[i].id.raw()) {
+            const auto& entry = new_entries[j++];
+            found.push_back({entry.position, {TaskChange::Kind::Added, entry.id, 0, nullptr, entry.task}});
+        } else {
+            const auto& old_entry = old_entries[i++];
+            const auto& new_entry = new_entries[j++];
+            // Неизмененная задача: совпали оба хеша, к задачам не обращаемся
+            if (old_entry.content == new_entry.content && old_entry.column == new_entry.column) {
+                continue;
+            }
+            if (unsigned fields = differing_fields(*old_entry.task, *new_entry.task)) {
+                found.push_back({new_entry.position,
+                                 {TaskChange::Kind::Changed, new_entry.id, fields, old_entry.task, new_entry.task}});
+            }
+        }
+    }
+
+    auto by_position = [](const auto& a, const auto& b) { return a.first < b.first; };
+    std::sort(found.begin(), found.end(), by_position);
+    std::sort(removed.begin(), removed.end(), by_position);
+    std::vector<TaskChange> changes;
+    changes.reserve(found.size() + removed.size());
+    for (auto& item : found) {
+        changes.push_back(item.second);
+    }
+    for (auto& item : removed) {
+        changes.push_back(item.second);
+    }
+    return changes;
+}
+
+// Трехстороннее слияние
+MergeResult merge_boards(const Board& base, Board& ours, const Board& theirs) {
+    return merge_boards(base, ours, theirs, diff_boards(base, theirs));
+}
+
+MergeResult merge_boards(const Board& base, Board& ours, const Board& theirs,
+                         const std::vector<TaskChange>& changes) {
+    MergeResult result;
+    Merger(ours, result).merge(base, theirs, changes);
+    return result;
+}
+
+// Строка изменения: "+" добавлена, "-" удалена, "~" изменена
+std::string describe_change(const TaskChange& change) {
+    const Task& task = change.after ? *change.after : *change.before;
+    std::string line = change.kind == TaskChange::Kind::Added ? "+ "
+                     : change.kind == TaskChange::Kind::Removed ? "- " : "~ ";
+    line += change.id.to_string();
+    line += " [";
+    line += column_name(task);
+    line += "] ";
+    line += task.get_title();
+    if (change.kind != TaskChange::Kind::Changed) {
+        return line;
+    }
+    const char* separator = ": ";
+    for (unsigned field : all_fields) {
+        if (!(change.fields & field)) {
+            continue;
+        }
+        line += separator;
+        separator = ", ";
+        line += field_name(field);
+        // Длинные поля выводятся только именем
+        if (field != DiffDescription && field != DiffTitle) {
+            line += " " + field_value(*change.before, field) + " -> " + field_value(*change.after, field);
+        }
+    }
+    return line;
+}
+
+// Строка конфликта
+std::string describe_conflict(const MergeConflict& conflict) {
+    std::string line = "! " + conflict.id.to_string() + " ";
+    switch (conflict.kind) {
+        case MergeConflict::Kind::BothChanged:
+            line += field_name(conflict.field);
+            if (conflict.field == DiffDescription) {
+                line += " changed on both sides";
+            } else {
+                line += ": ours '" + conflict.ours + "', theirs '" + conflict.theirs + "'";
+            }
+            break;
+        case MergeConflict::Kind::ChangedAndDeleted:
+            line += "changed in ours, deleted in theirs";
+            break;
+        case MergeConflict::Kind::DeletedAndChanged:
+            line += "deleted in ours, changed in theirs";
+            break;
+        case MergeConflict::Kind::Unsupported:
+            line += field_name(conflict.field);
+            line += ": theirs '" + conflict.theirs + "' cannot be applied, kept '" + conflict.ours + "'";
+            break;
+    }
+    return line;
+}
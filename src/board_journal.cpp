@@ -0,0 +1,530 @@
+#include "board_journal.h"
+#include <cstring>
+#include <filesystem>
+#include <stdexcept>
+#include <utility>
+#include <rapidjson/document.h>
+#include "board.h"
+#include "board_loader.h"
+#include "column.h"
+#include "developer.h"
+#include "json_worker.h"
+#include "mapped_file.h"
+#include "task.h"
+#include "written_files.h"
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+// Хеш FNV-1a содержимого снимка - связывает журнал с конкретным снимком
+std::uint64_t fnv1a(const char* data, std::size_t size) {
+    std::uint64_t hash = 1469598103934665603ull;
+    for (std::size_t i = 0; i < size; ++i) {
+        hash ^= static_cast<unsigned char>(data[i]);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+// Сброс файла из кеша ОС на диск (там, где это доступно)
+void sync_stream(std::FILE* file) {
+    if (std::fflush(file) != 0) {
+        throw std::runtime_error("Cannot write journal");
+    }
+#if !defined(_WIN32)
+    if (::fsync(::fileno(file)) != 0) {
+        throw std::runtime_error("Cannot write journal");
+    }
+#endif
+}
+
+void sync_path(const std::string& path) {
+#if !defined(_WIN32)
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd >= 0) {
+        ::fsync(fd);
+        ::close(fd);
+    }
+#else
+    (void)path;
+#endif
+}
+
+template <typename Writer>
+void write_string(Writer& writer, std::string_view text) {
+    writer.String(text.data(), static_cast<rapidjson::SizeType>(text.size()));
+}
+
+// Чтение полей записи с проверкой типов
+const rapidjson::Value& member(const rapidjson::Value& record, const char* name) {
+    auto it = record.FindMember(name);
+    if (it == record.MemberEnd()) {
+        throw std::runtime_error(std::string("Missing field: ") + name);
+    }
+    return it->value;
+}
+
+std::string_view string_field(const rapidjson::Value& record, const char* name) {
+    const rapidjson::Value& value = member(record, name);
+    if (!value.IsString()) {
+        throw std::runtime_error(std::string("Field is not a string: ") + name);
+    }
+    return std::string_view(value.GetString(), value.GetStringLength());
+}
+
+int int_field(const rapidjson::Value& record, const char* name) {
+    const rapidjson::Value& value = member(record, name);
+    if (!value.IsInt()) {
+        throw std::runtime_error(std::string("Field is not an integer: ") + name);
+    }
+    return value.GetInt();
+}
+
+std::size_t index_field(const rapidjson::Value& record, const char* name, std::size_t count) {
+    int index = int_field(record, name);
+    if (index < 0 || static_cast<std::size_t>(index) >= count) {
+        throw std::runtime_error(std::string("Index out of range: ") + name);
+    }
+    return static_cast<std::size_t>(index);
+}
+
+Task& task_field(Board& board, const rapidjson::Value& record) {
+    TaskId id = TaskId::from_string(string_field(record, "id"));
+    Task* task = board.find_task(id);
+    if (!task) {
+        throw std::runtime_error("Task not found: " + id.to_string());
+    }
+    return *task;
+}
+
+// Разработчик по имени ("" - без назначения)
+Developer* developer_field(Board& board, const rapidjson::Value& record) {
+    std::string_view name = string_field(record, "developer");
+    return name.empty() ? nullptr : board.find_developer(name);
+}
+
+// Заголовок журнала, относящийся к снимку с указанными размером и хешем
+bool is_header_of(const rapidjson::Value& record, std::uint64_t size, std::uint64_t hash) {
+    if (!record.IsObject()) {
+        return false;
+    }
+    auto op = record.FindMember("op");
+    auto size_it = record.FindMember("size");
+    auto hash_it = record.FindMember("hash");
+    return op != record.MemberEnd() && op->value.IsString() && std::strcmp(op->value.GetString(), "base") == 0 &&
+           size_it != record.MemberEnd() && size_it->value.IsUint64() && size_it->value.GetUint64() == size &&
+           hash_it != record.MemberEnd() && hash_it->value.IsUint64() && hash_it->value.GetUint64() == hash;
+}
+
+// Применение одной записи журнала к доске
+void apply_record(Board& board, const rapidjson::Value& record) {
+    if (!record.IsObject()) {
+        throw std::runtime_error("Journal record is not an object");
+    }
+    std::string_view op = string_field(record, "op");
+    auto& columns = board.get_columns();
+    auto& developers = board.get_developers();
+
+    if (op == "task_add") {
+        Column* column = columns[index_field(record, "column", columns.size())].get();
+        auto task = std::make_unique<Task>(string_field(record, "title"),
+                                           TaskId::from_string(string_field(record, "id")));
+        task->set_description(string_field(record, "description"));
+        int priority = int_field(record, "priority");
+        if (priority != -1) {
+            task->set_priority(priority);
+        }
+        task->set_developer(developer_field(board, record));
+        column->add_task(std::move(task));
+    } else if (op == "task_move") {
+        Task& task = task_field(board, record);
+        board.move_task(task.get_task_id(), columns[index_field(record, "column", columns.size())].get());
+    } else if (op == "task_remove") {
+        board.delete_task(task_field(board, record).get_task_id());
+    } else if (op == "task_title") {
+        task_field(board, record).set_title(string_field(record, "title"));
+    } else if (op == "task_description") {
+        task_field(board, record).set_description(string_field(record, "description"));
+    } else if (op == "task_priority") {
+        task_field(board, record).set_priority(int_field(record, "priority"));
+    } else if (op == "task_developer") {
+        task_field(board, record).set_developer(developer_field(board, record));
+    } else if (op == "task_id") {
+        task_field(board, record).set_id(TaskId::from_string(string_field(record, "new_id")));
+    } else if (op == "column_add") {
+        board.add_column(std::make_unique<Column>(std::string(string_field(record, "name"))));
+    } else if (op == "column_name") {
+        columns[index_field(record, "column", columns.size())]->set_name(std::string(string_field(record, "name")));
+    } else if (op == "columns_clear") {
+        board.clear_columns();
+    } else if (op == "developer_add") {
+        board.add_developer(std::make_unique<Developer>(std::string(string_field(record, "name"))));
+    } else if (op == "developer_name") {
+        developers[index_field(record, "developer", developers.size())]->set_name(std::string(string_field(record, "name")));
+    } else if (op == "developer_remove") {
+        board.delete_developer(developers[index_field(record, "developer", developers.size())].get());
+    } else if (op == "developers_clear") {
+        board.clear_developers();
+    } else if (op == "board_name") {
+        board.set_name(std::string(string_field(record, "name")));
+    } else {
+        throw std::runtime_error("Unknown journal operation: " + std::string(op));
+    }
+}
+
+} // namespace
+
+BoardJournal::BoardJournal(std::string snapshot)
+    : snapshot_path(std::move(snapshot)),
+      journal_path(snapshot_path + ".journal"),
+      snapshot_writer(snapshot_path + ".tmp"),
+      writer(line) {
+    snapshot_writer.set_column_cache(true);
+}
+
+BoardJournal::~BoardJournal() {
+    detach();
+}
+
+// Запись одной строки журнала
+// Строка собирается в буфере и пишется одним вызовом, а затем сбрасывается в ОС:
+// после падения процесса в файле остаются все записи, кроме, возможно, оборванной последней
+template <typename F>
+void BoardJournal::append(const char* op, F&& fill) {
+    if (!file) {
+        return;
+    }
+    line.Clear();
+    writer.Reset(line);
+    writer.StartObject();
+    writer.Key("op");
+    writer.String(op);
+    fill();
+    writer.EndObject();
+    line.Put('\n');
+    if (std::fwrite(line.GetString(), 1, line.GetSize(), file.get()) != line.GetSize() ||
+        std::fflush(file.get()) != 0) {
+        throw std::runtime_error("Cannot write journal: " + journal_path);
+    }
+    ++record_count;
+}
+
+// Позиция колонки на доске - задачи и колонки ссылаются на колонку по номеру
+std::size_t BoardJournal::column_position(const Column* column) const {
+    const auto& columns = board->get_columns();
+    for (std::size_t i = 0; i < columns.size(); ++i) {
+        if (columns[i].get() == column) {
+            return i;
+        }
+    }
+    throw std::logic_error("Column is not on the journaled board");
+}
+
+// Начало записи изменений доски
+void BoardJournal::attach(Board& target) {
+    detach();
+    board = &target;
+    compact();
+    board->set_listener(this);
+}
+
+// Отключение от доски
+void BoardJournal::detach() {
+    if (board && board->get_listener() == this) {
+        board->set_listener(nullptr);
+    }
+    board = nullptr;
+    file.reset();
+}
+
+// Запись заголовка нового журнала во временный файл, возвращает его путь
+// Журнал заменяет старый одним переименованием
+std::string BoardJournal::write_header(std::uint64_t snapshot_size, std::uint64_t snapshot_hash) {
+    const std::string temp_path = journal_path + ".tmp";
+    file.reset(std::fopen(temp_path.c_str(), "wb"));
+    if (!file) {
+        throw std::runtime_error("Cannot open file: " + temp_path);
+    }
+    append("base", [&] {
+        writer.Key("size");
+        writer.Uint64(snapshot_size);
+        writer.Key("hash");
+        writer.Uint64(snapshot_hash);
+    });
+    sync_stream(file.get());
+    file.reset();
+    record_count = 0;
+    return temp_path;
+}
+
+void BoardJournal::open_for_append() {
+    file.reset(std::fopen(journal_path.c_str(), "ab"));
+    if (!file) {
+        throw std::runtime_error("Cannot open file: " + journal_path);
+    }
+}
+
+// Сжатие: полный снимок доски и пустой журнал
+// Порядок шагов выбран так, что сбой на любом из них оставляет согласованную пару
+// снимок + журнал: новый снимок сначала пишется во временный файл, журнал для него -
+// тоже, и только потом оба переименовываются поверх старых
+void BoardJournal::compact() {
+    if (!board) {
+        throw std::logic_error("Journal is not attached to a board");
+    }
+    file.reset();
+    const std::string temp_path = snapshot_writer.get_save_path();
+    snapshot_writer.board_save(*board);
+    sync_path(temp_path);
+
+    std::uint64_t size;
+    std::uint64_t hash;
+    {
+        MappedFile snapshot(temp_path);
+        size = snapshot.size();
+        hash = fnv1a(snapshot.data(), snapshot.size());
+    }
+
+    const std::string journal_temp = write_header(size, hash);
+    std::filesystem::rename(temp_path, snapshot_path);
+    WrittenFiles::instance().record(snapshot_path);
+    std::filesystem::rename(journal_temp, journal_path);
+    open_for_append();
+}
+
+// Сброс журнала на диск
+void BoardJournal::sync() {
+    if (!board) {
+        return;
+    }
+    if (record_count >= compact_threshold) {
+        compact();
+    } else if (file) {
+        sync_stream(file.get());
+    }
+}
+
+// Восстановление доски из снимка и журнала
+std::size_t BoardJournal::recover(Board& target) {
+    detach();
+
+    // Загрузка снимка; слушатель на время загрузки и применения журнала отключен
+    target.set_listener(nullptr);
+    Json_worker loader(snapshot_path);
+    loader.board_load(target);
+    target.set_name(loader.get_loaded_board_name());
+
+    std::uint64_t size;
+    std::uint64_t hash;
+    {
+        MappedFile snapshot(snapshot_path);
+        size = snapshot.size();
+        hash = fnv1a(snapshot.data(), snapshot.size());
+    }
+
+    std::size_t applied = 0;
+    bool journal_valid = false;
+    std::size_t valid_length = 0;
+    if (std::filesystem::exists(journal_path)) {
+        MappedFile journal(journal_path);
+        char* data = journal.data();
+        std::size_t length = journal.size();
+        std::size_t position = 0;
+        bool header = true;
+        rapidjson::Document record;
+        while (position < length) {
+            char* end = static_cast<char*>(std::memchr(data + position, '\n', length - position));
+            // Строка без перевода строки - запись, оборванная сбоем
+            if (!end) {
+                break;
+            }
+            *end = '\0';
+            record.ParseInsitu(data + position);
+            if (record.HasParseError()) {
+                throw BoardLoadError("Invalid journal record", position + record.GetErrorOffset());
+            }
+            if (header) {
+                // Журнал другого снимка (например, сбой между заменой снимка и журнала) не применяется
+                if (!is_header_of(record, size, hash)) {
+                    break;
+                }
+                header = false;
+                journal_valid = true;
+            } else {
+                try {
+                    apply_record(target, record);
+                } catch (const std::exception& e) {
+                    throw BoardLoadError(std::string("Invalid journal record: ") + e.what(), position);
+                }
+                ++applied;
+            }
+            position = static_cast<std::size_t>(end - data) + 1;
+            valid_length = position;
+        }
+    }
+
+    board = &target;
+    if (journal_valid) {
+        // Оборванный хвост отрезается, чтобы новые записи начинались с новой строки
+        if (valid_length != std::filesystem::file_size(journal_path)) {
+            std::filesystem::resize_file(journal_path, valid_length);
+        }
+        record_count = applied;
+        open_for_append();
+    } else {
+        std::filesystem::rename(write_header(size, hash), journal_path);
+        open_for_append();
+    }
+    target.set_listener(this);
+    return applied;
+}
+
+// События доски
+
+void BoardJournal::on_board_renamed(const Board& b) {
+    append("board_name", [&] {
+        writer.Key("name");
+        write_string(writer, b.get_name());
+    });
+}
+
+void BoardJournal::on_column_added(const Column& column) {
+    append("column_add", [&] {
+        writer.Key("name");
+        write_string(writer, column.get_name());
+    });
+}
+
+void BoardJournal::on_column_renamed(const Column& column) {
+    append("column_name", [&] {
+        writer.Key("column");
+        writer.Uint64(column_position(&column));
+        writer.Key("name");
+        write_string(writer, column.get_name());
+    });
+}
+
+void BoardJournal::on_columns_cleared() {
+    append("columns_clear", [] {});
+}
+
+void BoardJournal::on_developer_added(const Developer& developer) {
+    append("developer_add", [&] {
+        writer.Key("name");
+        write_string(writer, developer.get_name());
+    });
+}
+
+void BoardJournal::on_developer_renamed(const Developer& developer) {
+    const auto& developers = board->get_developers();
+    std::size_t index = 0;
+    while (index < developers.size() && developers[index].get() != &developer) {
+        ++index;
+    }
+    append("developer_name", [&] {
+        writer.Key("developer");
+        writer.Uint64(index);
+        writer.Key("name");
+        write_string(writer, developer.get_name());
+    });
+}
+
+void BoardJournal::on_developer_removed(std::size_t index) {
+    append("developer_remove", [&] {
+        writer.Key("developer");
+        writer.Uint64(index);
+    });
+}
+
+void BoardJournal::on_developers_cleared() {
+    append("developers_clear", [] {});
+}
+
+void BoardJournal::on_task_added(const Task& task) {
+    append("task_add", [&] {
+        writer.Key("column");
+        writer.Uint64(column_position(task.get_column()));
+        writer.Key("id");
+        write_string(writer, task.get_id());
+        writer.Key("title");
+        write_string(writer, task.get_title());
+        writer.Key("description");
+        write_string(writer, task.get_description());
+        writer.Key("priority");
+        writer.Int(task.get_priority());
+        writer.Key("developer");
+        Developer* developer = task.get_developer();
+        write_string(writer, developer ? developer->get_name() : std::string_view());
+    });
+}
+
+void BoardJournal::on_task_moved(const Task& task) {
+    append("task_move", [&] {
+        writer.Key("id");
+        write_string(writer, task.get_id());
+        writer.Key("column");
+        writer.Uint64(column_position(task.get_column()));
+    });
+}
+
+void BoardJournal::on_task_removed(const Task& task) {
+    append("task_remove", [&] {
+        writer.Key("id");
+        write_string(writer, task.get_id());
+    });
+}
+
+void BoardJournal::on_task_changed(const Task& task, TaskField field) {
+    switch (field) {
+        case TaskField::Title:
+            append("task_title", [&] {
+                writer.Key("id");
+                write_string(writer, task.get_id());
+                writer.Key("title");
+                write_string(writer, task.get_title());
+            });
+            break;
+        case TaskField::Description:
+            append("task_description", [&] {
+                writer.Key("id");
+                write_string(writer, task.get_id());
+                writer.Key("description");
+                write_string(writer, task.get_description());
+            });
+            break;
+        case TaskField::Priority:
+            append("task_priority", [&] {
+                writer.Key("id");
+                write_string(writer, task.get_id());
+                writer.Key("priority");
+                writer.Int(task.get_priority());
+            });
+            break;
+        case TaskField::Developer:
+            append("task_developer", [&] {
+                writer.Key("id");
+                write_string(writer, task.get_id());
+                writer.Key("developer");
+                Developer* developer = task.get_developer();
+                write_string(writer, developer ? developer->get_name() : std::string_view());
+            });
+            break;
+    }
+}
+
+void BoardJournal::on_task_id_changed(const Task& task, TaskId old_id) {
+    append("task_id", [&] {
+        writer.Key("id");
+        write_string(writer, old_id.to_string());
+        writer.Key("new_id");
+        write_string(writer, task.get_id());
+    });
+}
+
+// Доска заменена загрузкой - журнал начинается заново с ее снимка
+void BoardJournal::on_board_replaced(const Board&) {
+    compact();
+}
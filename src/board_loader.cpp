@@ -0,0 +1,357 @@
+#include "board_loader.h"
+#include <climits>
+#include <stdexcept>
+#include "board.h"
+
+namespace {
+
+// Выполнение шага загрузки с перехватом исключений модели
+// Исключение нельзя пропускать через парсер rapidjson, поэтому оно сохраняется,
+// разбор прерывается возвратом false, а Json_worker пробрасывает его дальше
+template <typename F>
+bool guarded(std::exception_ptr& error, F&& step) {
+    try {
+        step();
+        return true;
+    } catch (...) {
+        error = std::current_exception();
+        return false;
+    }
+}
+
+// Сохранение строки токена
+// Строка из буфера разбора на месте (copy = false) не копируется,
+// а временная строка потокового разбора копируется в storage
+std::string_view keep(std::string& storage, const char* str, rapidjson::SizeType length, bool copy) {
+    if (!copy) {
+        return std::string_view(str, length);
+    }
+    storage.assign(str, length);
+    return storage;
+}
+
+} // namespace
+
+// Замена содержимого доски собранными данными
+void BoardStage::apply(Board& board) {
+    // Индекс ID строится до очистки доски: повтор ID в файле не оставляет доску пустой
+    std::unordered_map<TaskId, Task*> index;
+    std::size_t task_count = 0;
+    for (const auto& column : columns) {
+        task_count += column->get_tasks().size();
+    }
+    index.reserve(task_count);
+    for (const auto& column : columns) {
+        for (const auto& task : column->get_tasks()) {
+            if (!index.emplace(task->get_task_id(), task.get()).second) {
+                throw std::invalid_argument("Task ID already exists: " + task->get_id());
+            }
+        }
+    }
+
+    // Слушатель получает одно событие о замене доски вместо события на каждый объект
+    BoardListener* listener = board.get_listener();
+    board.set_listener(nullptr);
+    board.clear_columns();
+    board.clear_developers();
+    // Старые объекты доски уже удалены; арена с объектами, ушедшими с доски,
+    // остается жить внутри новой, поэтому замена не бросает после очистки
+    if (arena) {
+        board.replace_arena(std::move(arena));
+    }
+    for (auto& developer : developers) {
+        board.add_developer(std::move(developer));
+    }
+    board.add_indexed_columns(std::move(columns), std::move(index));
+    developers.clear();
+    columns.clear();
+    board.set_listener(listener);
+    if (listener) {
+        listener->on_board_replaced(board);
+    }
+}
+
+// Прерывание разбора из-за структуры файла
+bool BoardLoadHandler::fail(const char* message) {
+    structure_error = message;
+    return false;
+}
+
+// Скалярное значение: null, bool, дробное число или строка не на своем месте
+bool BoardLoadHandler::scalar() {
+    if (skip_depth > 0) {
+        return true;
+    }
+    switch (depth) {
+        case 0:
+            return fail("Root element is not an object");
+        case 1:
+            if (!board_done) {
+                return fail("Board data is not an object");
+            }
+            return true;
+        case 2:
+            // Поле доски со скалярным значением - это пустая колонка (кроме служебных полей)
+            if (key == "ids" || key == "developers") {
+                has_content = true;
+                return true;
+            }
+            return guarded(error, [this] { stage.columns.push_back(std::make_unique<Column>(key)); });
+        case 4:
+            field = Field::None;
+            return true;
+        default:
+            return true;
+    }
+}
+
+bool BoardLoadHandler::Int(int value) {
+    if (skip_depth == 0 && in_task && depth == 4 && field == Field::Priority) {
+        task.priority = value;
+        task.has_priority = true;
+        field = Field::None;
+        return true;
+    }
+    return scalar();
+}
+
+bool BoardLoadHandler::Uint(unsigned value) {
+    if (value <= static_cast<unsigned>(INT_MAX)) {
+        return Int(static_cast<int>(value));
+    }
+    return scalar();
+}
+
+bool BoardLoadHandler::String(const char* str, rapidjson::SizeType length, bool copy) {
+    if (skip_depth > 0) {
+        return true;
+    }
+    std::string_view text(str, length);
+    if (depth == 3 && section == Section::Ids) {
+        TaskId id = TaskId::from_string(text);
+        if (seen_ids.insert(id).second) {
+            stage.ids.push_back(id);
+        }
+        return true;
+    }
+    if (depth == 3 && section == Section::Developers) {
+        return guarded(error, [this, text] {
+            auto developer = std::make_unique<Developer>(std::string(text));
+            developers_by_name.emplace(developer->get_name(), developer.get());
+            stage.developers.push_back(std::move(developer));
+        });
+    }
+    if (depth == 4 && in_task) {
+        switch (field) {
+            case Field::Description:
+                task.description = keep(task.description_storage, str, length, copy);
+                task.has_description = true;
+                break;
+            case Field::Id:
+                task.id = TaskId::from_string(text);
+                break;
+            case Field::Developer:
+                task.developer = keep(task.developer_storage, str, length, copy);
+                task.has_developer = true;
+                break;
+            default:
+                break;
+        }
+        field = Field::None;
+        return true;
+    }
+    return scalar();
+}
+
+bool BoardLoadHandler::Key(const char* str, rapidjson::SizeType length, bool copy) {
+    if (skip_depth > 0) {
+        return true;
+    }
+    std::string_view text(str, length);
+    switch (depth) {
+        case 1:
+        case 2:
+            key.assign(text);
+            break;
+        case 3:
+            // Ключ внутри колонки - заголовок задачи
+            has_content = true;
+            task.title = keep(task.title_storage, str, length, copy);
+            break;
+        case 4:
+            if (text == "description") {
+                field = Field::Description;
+            } else if (text == "id") {
+                field = Field::Id;
+            } else if (text == "priority") {
+                field = Field::Priority;
+            } else if (text == "developer") {
+                field = Field::Developer;
+            } else {
+                field = Field::None;
+            }
+            break;
+        default:
+            break;
+    }
+    return true;
+}
+
+// Начало объекта или массива
+bool BoardLoadHandler::start_container(bool is_object) {
+    if (skip_depth > 0) {
+        ++skip_depth;
+        return true;
+    }
+    switch (depth) {
+        case 0:
+            if (!is_object) {
+                return fail("Root element is not an object");
+            }
+            break;
+        case 1:
+            // Загружается только первая доска файла, остальные пропускаются
+            if (board_done) {
+                skip_depth = 1;
+                return true;
+            }
+            if (!is_object) {
+                return fail("Board data is not an object");
+            }
+            board_found = true;
+            stage.board_name = key;
+            break;
+        case 2:
+            // Корень фрагмента - объект задач колонки
+            if (fragment_tasks) {
+                section = Section::Column;
+                break;
+            }
+            if (key == "ids" || key == "developers") {
+                has_content = true;
+                bool& seen = key == "ids" ? ids_seen : developers_seen;
+                // Используется первое поле с таким именем и только если это массив
+                if (seen || is_object) {
+                    skip_depth = 1;
+                    return true;
+                }
+                seen = true;
+                section = key == "ids" ? Section::Ids : Section::Developers;
+                break;
+            }
+            // Любое другое поле - колонка; задачи есть только у колонки-объекта
+            if (!guarded(error, [this] { stage.columns.push_back(std::make_unique<Column>(key)); })) {
+                return false;
+            }
+            if (!is_object) {
+                skip_depth = 1;
+                return true;
+            }
+            column = stage.columns.back().get();
+            object_columns.push_back(column);
+            section = Section::Column;
+            break;
+        case 3:
+            if (section != Section::Column || !is_object) {
+                skip_depth = 1;
+                return true;
+            }
+            // Начало задачи: поля предыдущей очищаются с сохранением буферов строк
+            in_task = true;
+            task.description = std::string_view();
+            task.developer = std::string_view();
+            task.id = TaskId();
+            task.priority = -1;
+            task.has_description = task.has_priority = task.has_developer = false;
+            field = Field::None;
+            break;
+        default:
+            // Вложенные значения в полях задачи не используются
+            field = Field::None;
+            skip_depth = 1;
+            return true;
+    }
+    ++depth;
+    return true;
+}
+
+// Конец объекта или массива
+bool BoardLoadHandler::end_container() {
+    if (skip_depth > 0) {
+        --skip_depth;
+        return true;
+    }
+    --depth;
+    switch (depth) {
+        case 3:
+            in_task = false;
+            return finish_task();
+        case 2:
+            section = Section::None;
+            column = nullptr;
+            break;
+        case 1:
+            // Доска должна содержать служебные поля или хотя бы одну задачу
+            if (!has_content) {
+                return fail("Board has no columns with tasks, developers or ids");
+            }
+            board_done = true;
+            break;
+        case 0:
+            if (!board_found) {
+                return fail("No board found in file");
+            }
+            break;
+        default:
+            break;
+    }
+    return true;
+}
+
+// Создание задачи из собранных полей
+bool BoardLoadHandler::finish_task() {
+    return guarded(error, [this] {
+        // Если в JSON есть ID - восстанавливаем его без генерации нового
+        auto created = std::make_unique<Task>(task.title, task.id);
+        if (task.has_description) {
+            created->set_description(task.description);
+        }
+        // -1 - приоритет по умолчанию, который пишет сохранение для задач без приоритета
+        if (task.has_priority && task.priority != -1) {
+            created->set_priority(task.priority);
+        }
+        if (task.has_developer && task.developer != "Unassigned") {
+            if (developers_seen || skeleton) {
+                // Если разработчик не найден, задача остается без назначения
+                if (Developer* developer = find_developer(task.developer)) {
+                    created->set_developer(developer);
+                }
+            } else {
+                // Массив developers еще не встретился - назначим в finish()
+                deferred_developers.emplace_back(created.get(), std::string(task.developer));
+            }
+        }
+        if (fragment_tasks) {
+            fragment_tasks->push_back(std::move(created));
+        } else {
+            column->add_task(std::move(created));
+        }
+    });
+}
+
+// Разработчик по имени; фрагмент колонки берет индекс обработчика скелета
+Developer* BoardLoadHandler::find_developer(std::string_view name) const {
+    const auto& index = skeleton ? skeleton->developers_by_name : developers_by_name;
+    auto it = index.find(name);
+    return it != index.end() ? it->second : nullptr;
+}
+
+// Завершение загрузки
+void BoardLoadHandler::finish() {
+    for (auto& [deferred_task, name] : deferred_developers) {
+        if (Developer* developer = find_developer(name)) {
+            deferred_task->set_developer(developer);
+        }
+    }
+    deferred_developers.clear();
+}
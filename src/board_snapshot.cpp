@@ -0,0 +1,59 @@
+#include "board_snapshot.h"
+#include <unordered_map>
+#include "board.h"
+#include "column.h"
+#include "developer.h"
+#include "task.h"
+
+// Копирование строки в общий буфер
+BoardSnapshot::Text BoardSnapshot::add(std::string_view value) {
+    Text ref{text.size(), value.size()};
+    text.append(value);
+    return ref;
+}
+
+// Снятие копии доски
+// Разработчики задач переводятся в номера, чтобы снимок не зависел от реестра
+BoardSnapshot BoardSnapshot::capture(const Board& board) {
+    BoardSnapshot snapshot;
+    snapshot.name = snapshot.add(board.get_name());
+
+    std::size_t task_count = 0;
+    for (const auto& column : board.get_columns()) {
+        task_count += column->get_tasks().size();
+    }
+    snapshot.tasks.reserve(task_count);
+    snapshot.columns.reserve(board.get_columns().size());
+
+    std::unordered_map<DeveloperHandle, uint32_t> developer_numbers;
+    developer_numbers.reserve(board.get_developers().size());
+    snapshot.developer_names.reserve(board.get_developers().size());
+    for (const auto& developer : board.get_developers()) {
+        developer_numbers.emplace(developer->get_handle(), static_cast<uint32_t>(snapshot.developer_names.size()));
+        snapshot.developer_names.push_back(snapshot.add(developer->get_name()));
+    }
+    snapshot.developer_count = snapshot.developer_names.size();
+
+    for (const auto& column : board.get_columns()) {
+        snapshot.columns.push_back({snapshot.add(column->get_name()), snapshot.tasks.size(), column->get_tasks().size()});
+        for (const auto& task : column->get_tasks()) {
+            TaskRecord record;
+            record.id = task->get_task_id();
+            record.title = snapshot.add(task->get_title());
+            record.description = snapshot.add(task->get_description());
+            record.priority = task->get_priority();
+            record.developer = no_developer;
+            // Реестр нужен только для разработчиков не с этой доски (и устаревших handle)
+            auto it = developer_numbers.find(task->get_developer_handle());
+            if (it != developer_numbers.end()) {
+                record.developer = it->second;
+            } else if (Developer* developer = task->get_developer()) {
+                record.developer = static_cast<uint32_t>(snapshot.developer_names.size());
+                developer_numbers.emplace(developer->get_handle(), record.developer);
+                snapshot.developer_names.push_back(snapshot.add(developer->get_name()));
+            }
+            snapshot.tasks.push_back(record);
+        }
+    }
+    return snapshot;
+}
@@ -0,0 +1,219 @@
+#include "board_watcher.h"
+#include <stdexcept>
+#include <system_error>
+#include <utility>
+#include <vector>
+#include "board.h"
+#include "board_loader.h"
+#include "column.h"
+#include "developer.h"
+#include "json_worker.h"
+#include "mapped_file.h"
+#include "written_files.h"
+#if defined(__linux__)
+#include <cerrno>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+// Есть ли в after колонки или разработчики, которых нет в before
+// Такие изменения без задач diff_boards не показывает, но слияние их переносит
+bool has_new_names(const Board& before, const Board& after) {
+    for (const auto& column : after.get_columns()) {
+        if (!before.find_column(column->get_name())) {
+            return true;
+        }
+    }
+    for (const auto& developer : after.get_developers()) {
+        if (!before.find_developer(developer->get_name())) {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace
+
+// Подключение к файлу и запуск потока наблюдателя
+BoardWatcher::BoardWatcher(Board& target, std::string file_path, Executor run_on_board_thread,
+                           Callback merged, std::chrono::milliseconds settle_time)
+    : board(target),
+      path(std::move(file_path)),
+      executor(std::move(run_on_board_thread)),
+      on_merged(std::move(merged)),
+      settle(settle_time) {
+#if defined(__linux__)
+    // Следим за каталогом: сохранение через временный файл заменяет файл новым
+    std::filesystem::path directory = std::filesystem::path(path).parent_path();
+    inotify_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (inotify_fd < 0) {
+        throw std::system_error(errno, std::generic_category(), "Cannot start file watcher");
+    }
+    if (inotify_add_watch(inotify_fd, directory.empty() ? "." : directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO) < 0 ||
+        pipe2(stop_pipe, O_CLOEXEC) != 0) {
+        int error = errno;
+        close(inotify_fd);
+        throw std::system_error(error, std::generic_category(), "Cannot watch file: " + path);
+    }
+#endif
+    // Исходная версия разбирается до запуска потока: запись другого процесса сразу после
+    // подключения уже считается изменением (inotify к этому моменту следит за каталогом)
+    reload();
+    worker = std::thread(&BoardWatcher::run, this);
+}
+
+BoardWatcher::~BoardWatcher() {
+    alive.reset();
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_one();
+#if defined(__linux__)
+    char byte = 0;
+    (void)!write(stop_pipe[1], &byte, 1);
+#endif
+    worker.join();
+#if defined(__linux__)
+    close(stop_pipe[0]);
+    close(stop_pipe[1]);
+    close(inotify_fd);
+#endif
+}
+
+// Поток наблюдателя: каждое изменение файла после исходной версии
+void BoardWatcher::run() {
+    while (wait_change()) {
+        reload();
+    }
+}
+
+// Ожидание изменения файла и паузы settle после него
+bool BoardWatcher::wait_change() {
+#if defined(__linux__)
+    const std::string name = std::filesystem::path(path).filename().string();
+    pollfd fds[2] = {{inotify_fd, POLLIN, 0}, {stop_pipe[0], POLLIN, 0}};
+    bool changed = false;
+    while (true) {
+        int ready = poll(fds, 2, changed ? static_cast<int>(settle.count()) : -1);
+        if (ready < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        if (fds[1].revents != 0) {
+            return false;
+        }
+        if (ready == 0) {
+            return true;  // Файл не менялся settle
+        }
+        // События каталога: нужны только те, что относятся к файлу доски
+        alignas(inotify_event) char buffer[4096];
+        ssize_t size;
+        while ((size = read(inotify_fd, buffer, sizeof(buffer))) > 0) {
+            for (char* position = buffer; position < buffer + size;) {
+                const auto* event = reinterpret_cast<const inotify_event*>(position);
+                if (event->len != 0 && name == event->name) {
+                    changed = true;
+                }
+                position += sizeof(inotify_event) + event->len;
+            }
+        }
+    }
+#else
+    bool changed = false;
+    std::unique_lock<std::mutex> lock(mutex);
+    while (!wake.wait_for(lock, settle, [this] { return stopping; })) {
+        std::error_code error;
+        auto time = std::filesystem::last_write_time(path, error);
+        auto size = std::filesystem::file_size(path, error);
+        if (error) {
+            continue;
+        }
+        if (time != seen_time || size != seen_size) {
+            seen_time = time;
+            seen_size = size;
+            changed = true;
+        } else if (changed) {
+            return true;
+        }
+    }
+    return false;
+#endif
+}
+
+// Разбор новой версии файла (в потоке наблюдателя)
+// Файл разбирается без вывода сообщений Json_worker: поток не должен писать в терминал
+void BoardWatcher::reload() {
+    auto next = std::make_shared<Board>(path);
+    FileStamp stamp;
+    try {
+#if !defined(__linux__)
+        std::error_code error;
+        seen_time = std::filesystem::last_write_time(path, error);
+        seen_size = std::filesystem::file_size(path, error);
+#endif
+        stamp = FileStamp::of(path);
+        MappedFile file(path);
+        if (FileStamp::of(path) != stamp) {
+            stamp = FileStamp();  // Файл заменен во время открытия - чья это версия, неизвестно
+        }
+        BoardStage stage;
+        Json_worker::stage_load(file.data(), 0, stage);
+        stage.apply(*next);
+    } catch (const std::exception& e) {
+        std::lock_guard<std::mutex> lock(mutex);
+        last_error = e.what();
+        return;
+    }
+    std::shared_ptr<const Board> previous = std::move(base);
+    base = next;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        last_error.clear();
+        ++version_count;
+    }
+    if (!previous) {
+        return;  // Исходная версия
+    }
+    // Версия, записанная самим приложением: ее правки уже в доске, а правки доски,
+    // сделанные после сохранения, не конфликт - версия становится новой базой без слияния
+    if (WrittenFiles::instance().contains(stamp)) {
+        return;
+    }
+
+    // Сравнение идет здесь, в потоке доски остается только слияние
+    auto changes = std::make_shared<std::vector<TaskChange>>(diff_boards(*previous, *next));
+    if (changes->empty() && !has_new_names(*previous, *next)) {
+        return;  // Файл перезаписан тем же содержимым
+    }
+    auto merge = [this, token = std::weak_ptr<char>(alive), previous, next, changes] {
+        if (!token.lock()) {
+            return;
+        }
+        MergeResult result = merge_boards(*previous, board, *next, *changes);
+        if (on_merged) {
+            on_merged(result);
+        }
+    };
+    if (executor) {
+        executor(std::move(merge));
+    } else {
+        merge();
+    }
+}
+
+std::size_t BoardWatcher::get_version_count() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return version_count;
+}
+
+std::string BoardWatcher::get_last_error() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return last_error;
+}
@@ -1,79 +1,231 @@
 #include <string>
 #include <memory>
 #include <algorithm>
+#include <iterator>
 #include <stdexcept>
 #include "column.h"
 #include "task.h"
 #include "board.h"
 
+// Конструктор колонки
+Column::Column(std::string n) : name(n, ArenaScope::resource()), revision(Board::next_revision()) {}
+
+// Отметка об изменении колонки
+// Доска получает ту же ревизию: ее ревизия меняется при изменении любой колонки
+void Column::touch() {
+    revision = Board::next_revision();
+    if (board) {
+        board->revision = revision;
+    }
+}
+
 // Добавление задачи в колонку
 void Column::add_task(std::unique_ptr<Task> task) {
     // Проверяем что задача не nullptr (защита от ошибок)
     if (!task) {
         throw std::invalid_argument("Task cannot be null");
     }
-    // Перемещаем задачу в конец списка задач колонки
+    attach_task(std::move(task), true);
+}
+
+// Пакетное добавление задач
+void Column::add_tasks(std::vector<std::unique_ptr<Task>> batch) {
+    // Проверка до первого изменения: колонка не остается заполненной наполовину
+    for (const auto& task : batch) {
+        if (!task) {
+            throw std::invalid_argument("Task cannot be null");
+        }
+    }
+    if (batch.empty()) {
+        return;
+    }
+    // ID проверяются в индексе доски до изменения колонки
+    if (board) {
+        board->task_index.reserve(board->task_index.size() + batch.size());
+        board->index_task_ids(batch);
+    }
+    tasks.reserve(batch.size());
+    // Индекс заголовков построится при первом поиске вместе с прежними задачами
+    title_index.clear();
+    titles_indexed = false;
+    for (auto& task : batch) {
+        Task* raw = task.get();
+        raw->column = this;
+        if (board) {
+            board->index_task_developer(raw);
+        }
+        raw->slot = tasks.push_back(std::move(task));
+    }
+    touch();
+    if (board && board->listener) {
+        for (auto it = std::prev(tasks.end(), static_cast<std::ptrdiff_t>(batch.size())); it != tasks.end(); ++it) {
+            board->listener->on_task_added(**it);
+        }
+    }
+}
+
+// Извлечение задачи из колонки с передачей владения
+std::unique_ptr<Task> Column::take_task(Task* task) {
+    return detach_task(task, true);
+}
+
+// Привязка задачи к колонке
+void Column::attach_task(std::unique_ptr<Task> task, bool update_board) {
+    // Сначала индекс ID доски: занятый ID не меняет колонку
+    if (board && update_board) {
+        board->index_task(task.get());
+    }
+    // Задача запоминает свою колонку и попадает в индекс заголовков
+    task->column = this;
+    index_title(task.get());
+    // Перемещаем задачу в конец списка задач колонки и запоминаем ее слот
     // std::move необходим потому что unique_ptr нельзя копировать
-    this->tasks.push_back(std::move(task)); 
+    Task* raw = task.get();
+    raw->slot = this->tasks.push_back(std::move(task));
+    touch();
+    if (board && update_board && board->listener) {
+        board->listener->on_task_added(*raw);
+    }
 }
 
-// Удаление задачи из колонки по заголовку
-void Column::delete_task(const std::string& task_title) {
-    // Поиск задачи по заголовку используя алгоритм find_if
-    // find_if проходит по всем элементам контейнера и проверяет условие
-    auto it = std::find_if(this->tasks.begin(), this->tasks.end(),
-        // Лямбда-функция для сравнения заголовка задачи
-        // [&] - захват всех переменных из внешней области по ссылке
-        [&](const std::unique_ptr<Task>& task) {
-            // Сравниваем заголовок текущей задачи с искомым
-            return task->get_title() == task_title;
-        });
+// Отвязка задачи от колонки
+std::unique_ptr<Task> Column::detach_task(Task* task, bool update_board) {
+    // Задача хранит свою колонку и слот - проверяем, что она действительно здесь
+    if (!task || task->column != this || this->tasks.at_slot(task->slot) != task) {
+        throw std::runtime_error("Task not found in source column");
+    }
+    
+    // Задача больше не принадлежит колонке
+    unindex_title(task);
+    if (board && update_board) {
+        board->unindex_task(task);
+    }
     
-    // Если задача найдена (итератор не указывает на конец контейнера)
-    if (it != this->tasks.end()) {
-        // Удаляем задачу из вектора
-        // unique_ptr автоматически освободит память при удалении
-        this->tasks.erase(it);
-    } else {
-        // Если задача не найдена, бросаем исключение
-        throw std::runtime_error("Task not found: " + task_title);
+    // Перемещаем владение и освобождаем слот - без сдвига остальных задач
+    auto task_ptr = this->tasks.remove(task->slot);
+    task_ptr->column = nullptr;
+    task_ptr->slot = TaskList::npos;
+    touch();
+    if (board && update_board && board->listener) {
+        board->listener->on_task_removed(*task_ptr);
     }
+    return task_ptr;
 }
 
-// Получение списка задач в колонке (неконстантная версия)
-// Возвращает ссылку на вектор задач для модификации
-std::vector<std::unique_ptr<Task>>& Column::get_tasks() {
-    return tasks;
+// Удаление задачи из колонки по заголовку
+void Column::delete_task(std::string_view task_title) {
+    // Поиск задачи по заголовку через индекс вместо линейного прохода
+    Task* task = find_task(task_title);
+    
+    // Если задача не найдена, бросаем исключение
+    if (!task) {
+        throw std::runtime_error("Task not found: " + std::string(task_title));
+    }
+    
+    // Извлекаем задачу - unique_ptr автоматически освободит память
+    take_task(task);
 }
 
-// Получение списка задач в колонке (константная версия)
-// Возвращает константную ссылку для чтения без модификации
-const std::vector<std::unique_ptr<Task>>& Column::get_tasks() const {
+// Получение списка задач в колонке только для чтения
+const TaskList& Column::get_tasks() const {
     return tasks;
 }
 
 // Получение названия колонки
-std::string Column::get_name() const {
+std::string_view Column::get_name() const {
     return name;
 }
 
 // Установка названия колонки
+// Индекс имен доски хранит представление старого имени - обновляем его
 void Column::set_name(std::string n) {
+    if (board) {
+        board->unindex_column(this);
+    }
     name = n;
+    touch();
+    if (board) {
+        board->index_column(this);
+        if (board->listener) {
+            board->listener->on_column_renamed(*this);
+        }
+    }
 }
 
 // Поиск задачи в колонке по заголовку
-Task* Column::find_task(const std::string& title) const {
-    // Используем алгоритм find_if для поиска задачи
-    auto it = std::find_if(tasks.begin(), tasks.end(),
-        // Лямбда-функция для проверки заголовка каждой задачи
-        [&](const std::unique_ptr<Task>& task) {
-            return task->get_title() == title;
-        });
+Task* Column::find_task(std::string_view title) const {
+    if (!titles_indexed) {
+        build_title_index();
+    }
+    // Поиск в хеш-индексе заголовков - O(1) в среднем
+    auto it = title_index.find(title);
     
     // Если задача найдена, возвращаем указатель
     // Если не найдена, возвращаем nullptr
-    return it != tasks.end() ? it->get() : nullptr;
+    return it != title_index.end() ? it->second : nullptr;
+}
+
+// Получение доски, на которой находится колонка
+Board* Column::get_board() const {
+    return board;
+}
+
+// Обновление индекса ID доски после смены ID задачи
+void Column::on_task_id_changed(Task* task, TaskId old_id) {
+    touch();
+    if (board) {
+        board->reindex_task(task, old_id);
+        if (board->listener) {
+            board->listener->on_task_id_changed(*task, old_id);
+        }
+    }
+}
+
+// Обновление обратного индекса разработчиков доски после смены назначения
+void Column::on_task_developer_changed(Task* task, DeveloperHandle old_developer) {
+    if (board) {
+        board->on_developer_changed(task, old_developer);
+    }
+    on_task_changed(task, TaskField::Developer);
+}
+
+// Сообщение слушателю доски об изменении поля задачи
+void Column::on_task_changed(Task* task, TaskField field) {
+    touch();
+    if (board && board->listener) {
+        board->listener->on_task_changed(*task, field);
+    }
+}
+
+// Добавление задачи в индекс заголовков
+void Column::index_title(Task* task) {
+    if (titles_indexed) {
+        title_index.emplace(task->get_title(), task);
+    }
+}
+
+// Удаление задачи из индекса заголовков
+// Среди задач с тем же заголовком удаляется именно переданная
+void Column::unindex_title(Task* task) {
+    if (!titles_indexed) {
+        return;
+    }
+    auto range = title_index.equal_range(task->get_title());
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second == task) {
+            title_index.erase(it);
+            return;
+        }
+    }
+}
+
+// Построение отложенного индекса заголовков по списку задач
+void Column::build_title_index() const {
+    title_index.reserve(tasks.size());
+    for (const auto& task : tasks) {
+        title_index.emplace(task->get_title(), task.get());
+    }
+    titles_indexed = true;
 }
 
 // Перемещение задачи между колонками
@@ -84,51 +236,33 @@ void move_task(Column* start, Column* end, Task* task) {
         throw std::invalid_argument("Columns and task cannot be null");
     }
     
-    // Получаем ссылку на список задач исходной колонки
-    auto& start_tasks = start->get_tasks();
-    
-    // Ищем задачу в исходной колонке по указателю
-    // Сравниваем именно по указателю, а не по содержимому
-    auto it = std::find_if(start_tasks.begin(), start_tasks.end(),
-        // Лямбда-функция для сравнения указателей
-        [&](const std::unique_ptr<Task>& t) {
-            // Сравниваем указатель задачи с искомым указателем
-            return t.get() == task;
-        });
-    
-    // Если задача найдена в исходной колонке
-    if (it != start_tasks.end()) {
-        // Перемещаем владение задачей с помощью std::move
-        // std::move необходим потому что unique_ptr нельзя копировать
-        // После этого it становится невалидным, поэтому сохраняем задачу
-        auto task_ptr = std::move(*it);
-        
-        // Удаляем задачу из исходной колонки
-        // Теперь задача находится в task_ptr и готова к перемещению
-        start_tasks.erase(it);
-        
-        // Добавляем задачу в целевую колонку, передавая владение
-        end->add_task(std::move(task_ptr));
-    } else {
-        // Если задача не найдена в исходной колонке
-        throw std::runtime_error("Task not found in source column");
+    // Извлекаем задачу из исходной колонки и передаем владение целевой
+    // Внутри одной доски индекс ID не меняется - обновляются только индексы заголовков
+    bool update_board = !(start->board && start->board == end->board);
+    // На другой доске ID может быть занят - проверка до извлечения задачи
+    if (update_board && end->board && end->board->find_task(task->get_task_id())) {
+        throw std::invalid_argument("Task ID already exists: " + task->get_id());
+    }
+    end->attach_task(start->detach_task(task, update_board), update_board);
+    if (!update_board && end->board->listener) {
+        end->board->listener->on_task_moved(*task);
     }
 }
 
 // Поиск задачи на всей доске по названию колонки и заголовку задачи
-Task* search_task(Board& board, const std::string& col, const std::string& title) {
+Task* search_task(Board& board, std::string_view col, std::string_view title) {
     // Поиск колонки по имени на доске
     Column* column = board.find_column(col);
     if (!column) {
         // Если колонка не найдена, бросаем исключение с информацией
-        throw std::runtime_error("Column not found: " + col);
+        throw std::runtime_error("Column not found: " + std::string(col));
     }
     
     // Поиск задачи в найденной колонке по заголовку
     Task* task = column->find_task(title);
     if (!task) {
         // Если задача не найдена, бросаем исключение с детальной информацией
-        throw std::runtime_error("Task not found: " + title + " in column: " + col);
+        throw std::runtime_error("Task not found: " + std::string(title) + " in column: " + std::string(col));
     }
     
     // Возвращаем указатель на найденную задачу
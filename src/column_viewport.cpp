@@ -0,0 +1,59 @@
+#include "column_viewport.h"
+#include <algorithm>
+#include "column.h"
+
+// Видимые задачи колонки
+std::vector<const Task*> ColumnViewport::visible_tasks(const Column& column, std::size_t visible_rows) {
+    const TaskList& tasks = column.get_tasks();
+    rows = std::max<std::size_t>(visible_rows, 1);
+    std::size_t last_offset = tasks.size() > rows ? tasks.size() - rows : 0;
+    offset = std::min(offset, last_offset);
+
+    // Колонка изменилась: запомненный итератор мог указывать на удаленную задачу
+    bool anchored = anchor_column == &column && anchor_revision == column.get_revision();
+    // Обход начинается от ближайшей к окну из точек: начало, конец, запомненная позиция
+    std::size_t from_begin = offset;
+    std::size_t from_end = tasks.size() - offset;
+    std::size_t from_anchor = offset > anchor_offset ? offset - anchor_offset : anchor_offset - offset;
+    if (!anchored || from_anchor > std::min(from_begin, from_end)) {
+        if (from_begin <= from_end) {
+            anchor = tasks.begin();
+            anchor_offset = 0;
+        } else {
+            anchor = tasks.end();
+            anchor_offset = tasks.size();
+        }
+    }
+    for (; anchor_offset < offset; ++anchor_offset) {
+        ++anchor;
+    }
+    for (; anchor_offset > offset; --anchor_offset) {
+        --anchor;
+    }
+    anchor_column = &column;
+    anchor_revision = column.get_revision();
+
+    std::vector<const Task*> result;
+    result.reserve(std::min(rows, tasks.size()));
+    for (auto it = anchor; it != tasks.end() && result.size() < rows; ++it) {
+        result.push_back(it->get());
+    }
+    return result;
+}
+
+// Прокрутка окна
+bool ColumnViewport::scroll(std::ptrdiff_t delta, std::size_t task_count) {
+    std::size_t last_offset = task_count > rows ? task_count - rows : 0;
+    std::size_t next = offset;
+    if (delta < 0) {
+        next -= std::min(offset, static_cast<std::size_t>(-delta));
+    } else {
+        next = std::min(offset + static_cast<std::size_t>(delta), last_offset);
+    }
+    next = std::min(next, last_offset);
+    if (next == offset) {
+        return false;
+    }
+    offset = next;
+    return true;
+}
@@ -0,0 +1,519 @@
+#include "csv_worker.h"
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cstdio>
+#include <cstring>
+#include <exception>
+#include <filesystem>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+#include "board.h"
+#include "board_arena.h"
+#include "board_loader.h"
+#include "column.h"
+#include "developer.h"
+#include "id_allocator.h"
+#include "mapped_file.h"
+#include "parallel_for.h"
+#include "task.h"
+
+namespace {
+
+// Поле записи по заголовку файла
+enum class Field { Column, Title, Id, Priority, Developer, Description, Unknown };
+
+// Запись в файл через буфер постоянного размера
+// Данные пишутся во временный файл "<путь>.tmp", который close() переименовывает в путь
+class CsvOutput {
+private:
+    std::string path;
+    std::string temp_path;
+    std::unique_ptr<std::FILE, int (*)(std::FILE*)> file;
+
+public:
+    explicit CsvOutput(const std::string& p)
+        : path(p), temp_path(p + ".tmp"), file(std::fopen(temp_path.c_str(), "wb"), &std::fclose) {
+        if (!file) {
+            throw std::runtime_error("Cannot open file for writing: " + path);
+        }
+        std::setvbuf(file.get(), nullptr, _IOFBF, 64 * 1024);
+    }
+
+    // Незавершенная запись не оставляет временный файл
+    ~CsvOutput() {
+        if (file) {
+            file.reset();
+            std::remove(temp_path.c_str());
+        }
+    }
+
+    void write(std::string_view text) {
+        if (!text.empty() && std::fwrite(text.data(), 1, text.size(), file.get()) != text.size()) {
+            throw std::runtime_error("Cannot write file: " + path);
+        }
+    }
+
+    void close() {
+        if (std::fclose(file.release()) != 0) {
+            std::remove(temp_path.c_str());
+            throw std::runtime_error("Cannot write file: " + path);
+        }
+        std::error_code error;
+        std::filesystem::rename(temp_path, path, error);
+        if (error) {
+            std::remove(temp_path.c_str());
+            throw std::runtime_error("Cannot write file: " + path);
+        }
+    }
+};
+
+// Добавление поля к строке записи; поле с разделителем, кавычкой или переводом строки
+// берется в кавычки, кавычки внутри удваиваются
+void append_field(std::string& line, std::string_view text, char delimiter) {
+    const char special[] = {delimiter, '"', '\n', '\r'};
+    if (text.find_first_of(std::string_view(special, sizeof(special))) == std::string_view::npos) {
+        line.append(text);
+        return;
+    }
+    line.push_back('"');
+    for (std::size_t pos = 0;;) {
+        std::size_t quote = text.find('"', pos);
+        line.append(text.substr(pos, quote - pos));
+        if (quote == std::string_view::npos) {
+            break;
+        }
+        line.append("\"\"");
+        pos = quote + 1;
+    }
+    line.push_back('"');
+}
+
+// Чтение записей CSV из буфера [begin, end) на месте
+// Поле в кавычках раскрывается в том же буфере, поэтому поля - представления в буфер
+// Ошибки - BoardLoadError со смещением от начала файла data
+class RecordReader {
+private:
+    const char* data;
+    char* p;
+    char* end;
+    char delimiter;
+    const char* record = nullptr;  // Начало последней прочитанной записи
+
+    [[noreturn]] void fail(const char* message, const char* at) const {
+        throw BoardLoadError(message, static_cast<std::size_t>(at - data));
+    }
+
+    // Поле в кавычках: p на открывающей кавычке
+    std::string_view quoted() {
+        char* start = p;
+        char* out = p;
+        char* read = p + 1;
+        for (;;) {
+            char* quote = static_cast<char*>(std::memchr(read, '"', static_cast<std::size_t>(end - read)));
+            if (!quote) {
+                fail("Unterminated quoted field", start);
+            }
+            std::memmove(out, read, static_cast<std::size_t>(quote - read));
+            out += quote - read;
+            read = quote + 1;
+            if (read == end || *read != '"') {
+                break;
+            }
+            // Удвоенная кавычка - одна кавычка в значении
+            *out++ = '"';
+            ++read;
+        }
+        p = read;
+        if (p != end && *p == '\r' && p + 1 != end && p[1] == '\n') {
+            ++p;
+        }
+        if (p != end && *p != delimiter && *p != '\n') {
+            fail("Unexpected character after quoted field", p);
+        }
+        return std::string_view(start, static_cast<std::size_t>(out - start));
+    }
+
+    // Поле без кавычек до разделителя или конца строки
+    std::string_view plain() {
+        char* start = p;
+        while (p != end && *p != delimiter && *p != '\n') {
+            if (*p == '"') {
+                fail("Quote inside unquoted field", p);
+            }
+            ++p;
+        }
+        char* stop = p;
+        if (stop != start && (p == end || *p == '\n') && stop[-1] == '\r') {
+            --stop;
+        }
+        return std::string_view(start, static_cast<std::size_t>(stop - start));
+    }
+
+public:
+    RecordReader(const char* file, char* begin, char* finish, char delim)
+        : data(file), p(begin), end(finish), delimiter(delim) {}
+
+    std::size_t tell() const { return static_cast<std::size_t>(p - data); }
+    std::size_t record_offset() const { return static_cast<std::size_t>(record - data); }
+
+    // Следующая запись в fields; false - данные кончились. Пустые строки пропускаются
+    bool next(std::vector<std::string_view>& fields) {
+        while (p != end && (*p == '\n' || (*p == '\r' && p + 1 != end && p[1] == '\n'))) {
+            p += *p == '\r' ? 2 : 1;
+        }
+        if (p == end) {
+            return false;
+        }
+        record = p;
+        fields.clear();
+        for (;;) {
+            fields.push_back(p != end && *p == '"' ? quoted() : plain());
+            if (p == end) {
+                return true;
+            }
+            if (*p++ == '\n') {
+                return true;
+            }
+        }
+    }
+};
+
+// Разметка записей по заголовку файла
+std::vector<Field> read_layout(const std::vector<std::string_view>& names, std::size_t offset) {
+    static const std::pair<const char*, Field> known[] = {
+        {"column", Field::Column}, {"title", Field::Title}, {"id", Field::Id},
+        {"priority", Field::Priority}, {"developer", Field::Developer}, {"description", Field::Description},
+    };
+    std::vector<Field> layout;
+    std::vector<bool> seen(std::size(known), false);
+    for (std::string_view name : names) {
+        std::string lower(name);
+        std::transform(lower.begin(), lower.end(), lower.begin(),
+                       [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        Field field = Field::Unknown;
+        for (std::size_t k = 0; k < std::size(known); ++k) {
+            // Повторное поле с тем же именем пропускается - используется первое
+            if (lower == known[k].first && !seen[k]) {
+                seen[k] = true;
+                field = known[k].second;
+            }
+        }
+        layout.push_back(field);
+    }
+    if (std::find(layout.begin(), layout.end(), Field::Column) == layout.end()) {
+        throw BoardLoadError("CSV header has no column field", offset);
+    }
+    if (std::find(layout.begin(), layout.end(), Field::Title) == layout.end()) {
+        throw BoardLoadError("CSV header has no title field", offset);
+    }
+    return layout;
+}
+
+// Задача, разобранная из записи, и имена, которые ищутся уже на доске
+struct ImportedRow {
+    std::string_view column;
+    std::string_view developer;
+    std::unique_ptr<Task> task;
+    std::size_t offset;
+};
+
+// Разбор записей части файла в задачи (без обращения к доске)
+void parse_rows(RecordReader& reader, const std::vector<Field>& layout, std::vector<ImportedRow>& rows) {
+    std::vector<std::string_view> fields;
+    while (reader.next(fields)) {
+        ImportedRow row;
+        row.offset = reader.record_offset();
+        std::string_view title, id, priority, description;
+        // Недостающие поля в конце записи считаются пустыми, лишние пропускаются
+        std::size_t count = std::min(fields.size(), layout.size());
+        for (std::size_t f = 0; f < count; ++f) {
+            switch (layout[f]) {
+                case Field::Column: row.column = fields[f]; break;
+                case Field::Title: title = fields[f]; break;
+                case Field::Id: id = fields[f]; break;
+                case Field::Priority: priority = fields[f]; break;
+                case Field::Developer: row.developer = fields[f]; break;
+                case Field::Description: description = fields[f]; break;
+                case Field::Unknown: break;
+            }
+        }
+        // Те же правила, что у create_task
+        if (title.empty()) {
+            throw BoardLoadError("Task title cannot be empty", row.offset);
+        }
+        if (row.column.empty()) {
+            throw BoardLoadError("Column name cannot be empty", row.offset);
+        }
+        auto task = std::make_unique<Task>(title, TaskId::from_string(id));
+        if (!description.empty()) {
+            task->set_description(description);
+        }
+        if (!priority.empty()) {
+            int value = 0;
+            auto [stop, error] = std::from_chars(priority.data(), priority.data() + priority.size(), value);
+            if (error != std::errc() || stop != priority.data() + priority.size()) {
+                throw BoardLoadError("Priority is not a number", row.offset);
+            }
+            // -1 - приоритет по умолчанию, как в JSON
+            if (value != -1) {
+                task->set_priority(value);
+            }
+        }
+        row.task = std::move(task);
+        rows.push_back(std::move(row));
+    }
+}
+
+// Деление [begin, end) на части примерно по chunk_bytes по границам записей
+// В правильном файле кавычки парные (удвоенная кавычка - это две кавычки), поэтому
+// перевод строки начинает запись, только если перед ним четное число кавычек
+std::vector<char*> split_records(char* begin, char* end, std::size_t chunk_bytes) {
+    std::vector<char*> starts{begin};
+    bool quoted = false;
+    char* p = begin;
+    while (static_cast<std::size_t>(end - starts.back()) > chunk_bytes) {
+        char* target = starts.back() + chunk_bytes;
+        for (char* q; (q = static_cast<char*>(std::memchr(p, '"', static_cast<std::size_t>(target - p)))); p = q + 1) {
+            quoted = !quoted;
+        }
+        p = target;
+        // Первый перевод строки вне кавычек
+        for (;;) {
+            char* newline = static_cast<char*>(std::memchr(p, '\n', static_cast<std::size_t>(end - p)));
+            if (!newline) {
+                return starts;
+            }
+            for (char* q; (q = static_cast<char*>(std::memchr(p, '"', static_cast<std::size_t>(newline - p)))); p = q + 1) {
+                quoted = !quoted;
+            }
+            p = newline + 1;
+            if (!quoted) {
+                break;
+            }
+        }
+        if (p == end) {
+            break;
+        }
+        starts.push_back(p);
+    }
+    return starts;
+}
+
+} // namespace
+
+// Конструктор с разделителем по расширению файла
+Csv_worker::Csv_worker(std::string file_path) : path(std::move(file_path)), delimiter(',') {
+    std::string extension = std::filesystem::path(path).extension().string();
+    std::transform(extension.begin(), extension.end(), extension.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    if (extension == ".tsv") {
+        delimiter = '\t';
+    }
+}
+
+void Csv_worker::set_threads(unsigned count) {
+    threads = count != 0 ? count : std::max(1u, std::thread::hardware_concurrency());
+}
+
+// Экспорт задач доски
+std::size_t Csv_worker::board_export(const Board& board) const {
+    CsvOutput output(path);
+    std::string line;
+    const char* names[] = {"column", "title", "id", "priority", "developer", "description"};
+    for (const char* name : names) {
+        if (!line.empty()) {
+            line.push_back(delimiter);
+        }
+        line.append(name);
+    }
+    line.push_back('\n');
+    output.write(line);
+
+    // Строка записи переиспользуется: память ограничена самой длинной задачей
+    std::size_t count = 0;
+    for (const auto& column : board.get_columns()) {
+        for (const auto& task : column->get_tasks()) {
+            line.clear();
+            append_field(line, column->get_name(), delimiter);
+            line.push_back(delimiter);
+            append_field(line, task->get_title(), delimiter);
+            line.push_back(delimiter);
+            append_field(line, task->get_id(), delimiter);
+            line.push_back(delimiter);
+            if (task->get_priority() != -1) {
+                char digits[16];
+                auto result = std::to_chars(digits, digits + sizeof(digits), task->get_priority());
+                line.append(digits, result.ptr);
+            }
+            line.push_back(delimiter);
+            if (Developer* developer = task->get_developer()) {
+                append_field(line, developer->get_name(), delimiter);
+            }
+            line.push_back(delimiter);
+            append_field(line, task->get_description(), delimiter);
+            line.push_back('\n');
+            output.write(line);
+            ++count;
+        }
+    }
+    output.close();
+    return count;
+}
+
+// Импорт задач в доску
+// 1. Заголовок разбирается последовательно, остальное делится на части по записям
+// 2. Части разбираются на threads потоках в задачи (у каждого потока своя арена,
+//    если у доски включена арена); ошибка - из самой ранней части, как при последовательном разборе
+// 3. Имена колонок и разработчиков проверяются до изменения доски
+// 4. Задачи добавляются пакетами по колонкам через Column::add_tasks
+std::size_t Csv_worker::board_import(Board& board) const {
+    MappedFile file(path);
+    char* data = file.data();
+    char* end = data + file.size();
+    char* begin = data;
+    // Метка порядка байт UTF-8 в начале файла пропускается
+    if (file.size() >= 3 && std::memcmp(data, "\xEF\xBB\xBF", 3) == 0) {
+        begin += 3;
+    }
+
+    RecordReader header(data, begin, end, delimiter);
+    std::vector<std::string_view> names;
+    if (!header.next(names)) {
+        throw BoardLoadError("CSV file has no header", static_cast<std::size_t>(begin - data));
+    }
+    const std::vector<Field> layout = read_layout(names, header.record_offset());
+    char* body = data + header.tell();
+
+    // Несколько частей на поток выравнивают нагрузку между потоками
+    const std::size_t body_size = static_cast<std::size_t>(end - body);
+    const std::size_t chunk_bytes = threads > 1
+        ? std::max<std::size_t>(1 << 20, body_size / (std::size_t(threads) * 4) + 1)
+        : body_size;
+    std::vector<char*> starts = split_records(body, end, chunk_bytes);
+
+    // Арены объявлены до частей: при ошибке задачи частей удаляются раньше своих арен
+    std::vector<std::unique_ptr<BoardArena>> arenas(board.get_arena() ? threads : 0);
+    for (auto& arena : arenas) {
+        arena = std::make_unique<BoardArena>();
+    }
+    struct Chunk {
+        char* begin;
+        char* end;
+        std::vector<ImportedRow> rows;
+        std::exception_ptr error;
+    };
+    std::vector<Chunk> chunks;
+    for (std::size_t i = 0; i < starts.size(); ++i) {
+        chunks.push_back({starts[i], i + 1 < starts.size() ? starts[i + 1] : end, {}, nullptr});
+    }
+    parallel_for(chunks.size(), threads, [&](std::size_t index, unsigned worker) {
+        Chunk& chunk = chunks[index];
+        ArenaScope arena_scope(arenas.empty() ? nullptr : arenas[worker].get());
+        try {
+            RecordReader reader(data, chunk.begin, chunk.end, delimiter);
+            parse_rows(reader, layout, chunk.rows);
+        } catch (...) {
+            chunk.error = std::current_exception();
+        }
+    });
+    for (const auto& chunk : chunks) {
+        if (chunk.error) {
+            std::rethrow_exception(chunk.error);
+        }
+    }
+
+    // Проверка имен: соседние записи обычно из одной колонки, поэтому поиск
+    // идет только при смене имени
+    std::vector<std::string_view> new_columns;
+    std::vector<std::string_view> new_developers;
+    std::unordered_set<std::string_view> new_column_names;
+    std::unordered_set<std::string_view> new_developer_names;
+    std::string_view last_column, last_developer;
+    for (const auto& chunk : chunks) {
+        for (const auto& row : chunk.rows) {
+            if (row.column != last_column) {
+                last_column = row.column;
+                if (!board.find_column(row.column) && new_column_names.insert(row.column).second) {
+                    if (!create_missing) {
+                        throw BoardLoadError("Column not found: " + std::string(row.column), row.offset);
+                    }
+                    new_columns.push_back(row.column);
+                }
+            }
+            if (!row.developer.empty() && row.developer != last_developer) {
+                last_developer = row.developer;
+                if (!board.find_developer(row.developer) && new_developer_names.insert(row.developer).second) {
+                    if (!create_missing) {
+                        throw BoardLoadError("Developer not found: " + std::string(row.developer), row.offset);
+                    }
+                    new_developers.push_back(row.developer);
+                }
+            }
+        }
+    }
+
+    // Доска меняется только отсюда
+    {
+        ArenaScope arena_scope(board.get_arena());
+        for (std::string_view name : new_developers) {
+            board.add_developer(std::make_unique<Developer>(std::string(name)));
+        }
+        for (std::string_view name : new_columns) {
+            board.add_column(std::make_unique<Column>(std::string(name)));
+        }
+    }
+
+    // Пакеты задач по колонкам в порядке первого появления колонки в файле
+    std::vector<std::pair<Column*, std::vector<std::unique_ptr<Task>>>> batches;
+    std::unordered_map<std::string_view, std::size_t> batch_index;
+    std::size_t batch = 0;
+    Developer* developer = nullptr;
+    last_column = last_developer = std::string_view();
+    // ID, уже занятые задачами этого импорта: индекс доски их еще не видит
+    std::unordered_set<TaskId> taken;
+    std::size_t count = 0;
+    for (auto& chunk : chunks) {
+        for (auto& row : chunk.rows) {
+            if (batches.empty() || row.column != last_column) {
+                last_column = row.column;
+                auto [it, inserted] = batch_index.emplace(row.column, batches.size());
+                if (inserted) {
+                    batches.emplace_back(board.find_column(row.column), std::vector<std::unique_ptr<Task>>());
+                }
+                batch = it->second;
+            }
+            if (!row.developer.empty()) {
+                if (!developer || row.developer != last_developer) {
+                    last_developer = row.developer;
+                    developer = board.find_developer(row.developer);
+                }
+                row.task->set_developer(developer);
+            }
+            if (board.find_task(row.task->get_task_id()) || !taken.insert(row.task->get_task_id()).second) {
+                // set_id регистрирует ID еще раз - выделение отпускается, владельцем остается задача
+                TaskId fresh = Task::generate_id();
+                row.task->set_id(fresh);
+                IdAllocator::instance().release(fresh);
+                taken.insert(fresh);
+            }
+            batches[batch].second.push_back(std::move(row.task));
+            ++count;
+        }
+    }
+    for (auto& [column, tasks] : batches) {
+        column->add_tasks(std::move(tasks));
+    }
+    for (auto& arena : arenas) {
+        board.get_arena()->adopt(std::move(arena));
+    }
+    return count;
+}
@@ -1,10 +1,11 @@
 #include "developer.h"
+#include "board.h"
 #include <string>
 #include <stdexcept>
 
 // Получение имени разработчика
-// Простой геттер, возвращает копию имени
-std::string Developer::get_name() const {
+// Простой геттер, возвращает представление имени без копирования
+std::string_view Developer::get_name() const {
     return name;
 }
 
@@ -16,5 +17,30 @@ void Developer::set_name(std::string n) {
         throw std::invalid_argument("Developer name cannot be empty");
     }
     // Если проверка пройдена, устанавливаем новое имя
+    assign_name(n);
+}
+
+// Присваивание разработчика - переименование в имя other
+Developer& Developer::operator=(const Developer& other) {
+    if (this != &other) {
+        assign_name(other.name);
+    }
+    return *this;
+}
+
+// Замена имени
+// Индекс имен доски хранит представление старого имени - обновляем его
+void Developer::assign_name(std::string_view n) {
+    if (board) {
+        board->unindex_developer(this);
+    }
     name = n;
+    if (board) {
+        board->index_developer(this);
+        board->touch_developer_columns(handle);
+        board->touch();
+        if (board->listener) {
+            board->listener->on_developer_renamed(*this);
+        }
+    }
 }
\ No newline at end of file
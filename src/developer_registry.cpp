@@ -0,0 +1,67 @@
+#include "developer_registry.h"
+#include <mutex>
+#include <stdexcept>
+
+DeveloperRegistry& DeveloperRegistry::instance() {
+    static DeveloperRegistry registry;
+    return registry;
+}
+
+// Регистрация разработчика
+DeveloperHandle DeveloperRegistry::add(Developer* developer) {
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    // Сначала используем освободившиеся слоты
+    uint32_t index;
+    if (!free_slots.empty()) {
+        index = free_slots.back();
+        free_slots.pop_back();
+    } else {
+        if (slots.size() > DeveloperHandle::index_mask) {
+            throw std::length_error("Too many developers");
+        }
+        index = static_cast<uint32_t>(slots.size());
+        slots.emplace_back();
+    }
+
+    Slot& slot = slots[index];
+    slot.developer = developer;
+    ++count;
+    return DeveloperHandle(index, slot.generation);
+}
+
+// Снятие разработчика с учета
+void DeveloperRegistry::remove(DeveloperHandle handle) {
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    uint32_t index = handle.index();
+    if (!handle.valid() || index >= slots.size() || slots[index].generation != handle.generation()) {
+        return;
+    }
+
+    // Новое поколение делает недействительными все старые handle на этот слот
+    // Исчерпавший поколения слот выводится из оборота навсегда: поколение не
+    // переходит через ноль, и ни один выданный ранее handle не совпадет снова
+    Slot& slot = slots[index];
+    slot.developer = nullptr;
+    --count;
+    if (slot.generation == DeveloperHandle::max_generation) {
+        return;
+    }
+    ++slot.generation;
+    free_slots.push_back(index);
+}
+
+// Разработчик по handle
+Developer* DeveloperRegistry::get(DeveloperHandle handle) const {
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    uint32_t index = handle.index();
+    if (!handle.valid() || index >= slots.size()) {
+        return nullptr;
+    }
+    const Slot& slot = slots[index];
+    return slot.generation == handle.generation() ? slot.developer : nullptr;
+}
+
+std::size_t DeveloperRegistry::size() const {
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    return count;
+}
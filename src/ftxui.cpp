@@ -1,5 +1,7 @@
 #include "ftxui.h"
 #include "manager.h"
+#include "board_loader.h"
+#include <ftxui/screen/terminal.hpp>
 #include <iostream>
 #include <algorithm>
 #include <filesystem>
@@ -8,6 +10,15 @@
 
 using namespace ftxui;
 
+namespace {
+
+// Строки экрана вокруг содержимого колонки на вкладке доски: заголовки приложения и доски,
+// вкладки, кнопки, рамка колонки, ее заголовок и строка позиции
+// Нужна только в первом кадре, пока область колонки еще не известна
+constexpr int board_chrome_height = 14;
+
+} // namespace
+
 // Метод для создания стилизованных компонентов ввода
 Component ScrumBoardUI::create_styled_input(std::string* content, const std::string& placeholder) {
     auto input = Input(content, placeholder);
@@ -28,7 +39,38 @@ void ScrumBoardUI::refresh_ui_data() {
     // Обновление списка названий колонок
     column_names.clear();
     for (const auto& col : board->get_columns()) {
-        column_names.push_back(col->get_name());
+        column_names.emplace_back(col->get_name());
+    }
+}
+
+// Наблюдение за файлом открытой доски
+// Разбор файла и сравнение идут в потоке наблюдателя, в поток UI приходит только слияние
+// изменений - выбор в списках и несохраненные правки остаются на месте
+void ScrumBoardUI::watch_board_file() {
+    watcher.reset();
+    if (!post_to_ui) {
+        return;
+    }
+    try {
+        watcher = std::make_unique<BoardWatcher>(*board, save_path, post_to_ui, [this](const MergeResult& result) {
+            if (result.applied == 0 && result.conflicts.empty()) {
+                return;  // Изменения файла уже есть в доске
+            }
+            // Журнал относится к снимку, который другой процесс заменил, - начинаем новый
+            // с текущей доски, чтобы слитые изменения пережили перезапуск
+            if (journal) {
+                journal->compact();
+                board->mark_saved();
+            }
+            refresh_ui_data();
+            for (const MergeConflict& conflict : result.conflicts) {
+                std::cout << describe_conflict(conflict) << std::endl;
+            }
+            std::cout << "Board file changed: " << result.applied << " changes merged, "
+                      << result.conflicts.size() << " conflicts" << std::endl;
+        });
+    } catch (const std::exception& e) {
+        std::cout << "Cannot watch board file: " << e.what() << std::endl;
     }
 }
 
@@ -37,6 +79,7 @@ ScrumBoardUI::ScrumBoardUI() {
     // Создание новой доски с именем по умолчанию
     // std::make_shared создает объект и возвращает shared_ptr
     board = std::make_shared<Board>("ScrumBoard");
+    board->enable_arena();  // Загруженные доски размещаются в арене
     
     initialize_board();    // Инициализация начального состояния доски
     setup_ui_components(); // Настройка компонентов интерфейса
@@ -69,7 +112,10 @@ void ScrumBoardUI::update_task_list() {
         for (const auto& task : col->get_tasks()) {
             // Формат: "Название задачи (Название колонки)"
             // Это помогает пользователю видеть в какой колонке находится задача
-            task_titles.push_back(task->get_title() + " (" + col->get_name() + ")");
+            std::string entry;
+            entry.reserve(task->get_title().size() + col->get_name().size() + 3);
+            entry.append(task->get_title()).append(" (").append(col->get_name()).append(")");
+            task_titles.push_back(std::move(entry));
         }
     }
     
@@ -88,7 +134,7 @@ void ScrumBoardUI::update_developer_list() {
     
     // Сбор имен всех разработчиков
     for (const auto& dev : board->get_developers()) {
-        developer_names.push_back(dev->get_name());
+        developer_names.emplace_back(dev->get_name());
     }
     
     // Корректировка выбранного разработчика если необходимо
@@ -344,32 +390,11 @@ void ScrumBoardUI::handle_delete_developer() {
         Developer* developer = board->find_developer(dev_name);
         if (developer) {
             try {
-                // Удаление разработчика из всех задач
-                // Проходим по всем колонкам и всем задачам
-                for (const auto& col : board->get_columns()) {
-                    for (const auto& task : col->get_tasks()) {
-                        // Если задача назначена на этого разработчика
-                        if (task->get_developer() == developer) {
-                            // Снимаем назначение
-                            task->set_developer(nullptr);
-                        }
-                    }
-                }
-                
-                // Удаление разработчика из доски
-                auto& developers = board->get_developers();
-                // Ищем разработчика в списке по указателю
-                auto it = std::find_if(developers.begin(), developers.end(),
-                    [&](const std::unique_ptr<Developer>& dev) {
-                        return dev.get() == developer;
-                    });
-                
-                // Если разработчик найден, удаляем его
-                if (it != developers.end()) {
-                    developers.erase(it);
-                    refresh_ui_data(); // Обновление UI
-                    std::cout << "Developer deleted successfully!" << std::endl;
-                }
+                // Handle разработчика в задачах устаревают при удалении,
+                // поэтому задачи сразу показываются как Unassigned
+                board->delete_developer(developer);
+                refresh_ui_data(); // Обновление UI
+                std::cout << "Developer deleted successfully!" << std::endl;
             } catch (const std::exception& e) {
                 std::cout << "Error deleting developer: " << e.what() << std::endl;
             }
@@ -462,27 +487,39 @@ void ScrumBoardUI::handle_save_load_dialog(bool is_save, const std::string& new_
             }
             
             try {
-                // Сбор ID всех задач для сохранения (нужно для отслеживания уникальности)
-                std::vector<std::string> current_ids;
-                for (const auto& col : board->get_columns()) {
-                    for (const auto& task : col->get_tasks()) {
-                        current_ids.push_back(task->get_id());
-                    }
-                }
+                // Установка имени доски из имени файла (без расширения) - до записи,
+                // чтобы имя попало в сохраняемый снимок
+                std::string board_name = full_path.stem().string();
+                board->set_name(board_name);
                 
                 // Инициализируем JSON worker с путем для сохранения
                 json_worker = std::make_shared<Json_worker>(full_path.string());
-                // Очищаем предыдущие ID
-                json_worker->clear_ids();
-                // Добавляем доску в JSON с текущими ID задач
-                json_worker->board_add(*board, json_worker->ids_add(current_ids));
-                // Сохраняем в файл
-                json_worker->save();
+                if (autosave_delay.count() > 0) {
+                    // Запись идет в потоке автосохранения - UI ждет только снятия снимка
+                    journal.reset();
+                    if (!autosave || autosave->get_path() != full_path.string()) {
+                        autosave.reset();
+                        autosave = std::make_unique<AutosaveService>(*board, full_path.string(), autosave_delay, post_to_ui);
+                    }
+                    autosave->save_now();
+                } else if (journal && journal->get_snapshot_path() == full_path.string()) {
+                    // Изменения уже записаны в журнал - достаточно сбросить его на диск
+                    // (при накоплении записей журнал сжимается в полный снимок)
+                    journal->sync();
+                } else {
+                    // Новый файл: полный снимок доски и журнал для дальнейших изменений
+                    journal.reset();
+                    journal = std::make_unique<BoardJournal>(full_path.string());
+                    journal->attach(*board);
+                }
+                // Журнал записан на диск - доска больше не считается измененной
+                if (!autosave) {
+                    board->mark_saved();
+                }
                 save_path = full_path.string();
-                
-                // Установка имени доски из имени файла (без расширения)
-                std::string board_name = full_path.stem().string();
-                board->set_name(board_name);
+                if (!watcher || watcher->get_path() != save_path) {
+                    watch_board_file();
+                }
                 
                 std::cout << "Board successfully saved to: " << full_path.string() << std::endl;
                 std::cout << "Board name set to: " << board_name << std::endl;
@@ -505,33 +542,70 @@ void ScrumBoardUI::handle_save_load_dialog(bool is_save, const std::string& new_
                 return;
             }
             
-            // Проверяем валидность файла перед загрузкой
-            Json_worker temp_worker(full_path.string());
-            if (!temp_worker.is_valid_board_file(full_path.string())) {
-                std::cout << "Error: Invalid board file format: " << full_path.string() << std::endl;
-                return;
+            // Автосохранение старой доски дописывает ее изменения и отключается,
+            // чтобы загруженное содержимое не записалось в старый файл
+            // Слияния, ожидающие в очереди UI, относятся к старой доске - отменяем их
+            bool watching = watcher != nullptr;
+            watcher.reset();
+            std::string autosave_path;
+            if (autosave) {
+                autosave_path = autosave->get_path();
+                autosave.reset();
             }
-            
             try {
-                // Инициализируем JSON worker для загрузки
-                json_worker = std::make_shared<Json_worker>(full_path.string());
+                if (autosave_delay.count() > 0) {
+                    Json_worker(full_path.string()).board_load(*board);
+                    journal.reset();
+                    autosave = std::make_unique<AutosaveService>(*board, full_path.string(), autosave_delay, post_to_ui);
+                    json_worker = std::make_shared<Json_worker>(full_path.string());
+                } else {
+                    // Проверка структуры, разбор и построение доски - за одно чтение файла,
+                    // затем применение журнала изменений, если он остался после сбоя
+                    // JSON worker, журнал и путь заменяются только после успешной загрузки
+                    auto next_journal = std::make_unique<BoardJournal>(full_path.string());
+                    std::size_t replayed = next_journal->recover(*board);
+                    journal = std::move(next_journal);
+                    json_worker = std::make_shared<Json_worker>(full_path.string());
+                    if (replayed != 0) {
+                        std::cout << "Recovered " << replayed << " unsaved changes from journal" << std::endl;
+                    }
+                }
                 
-                // Установка имени доски из имени файла
+                // Устанавливаем имя доски из имени файла
                 std::string board_name = full_path.stem().string();
-                
-                // Загружаем данные доски из JSON
-                json_worker->board_load(*board);
-                
-                // Устанавливаем имя доски
                 board->set_name(board_name);
+                // Загруженная доска совпадает с файлом
+                board->mark_saved();
                 
                 // Инициализируем и обновляем UI после загрузки
+                // Прокрутка колонок начинается сначала
+                column_viewports.clear();
                 initialize_board();
                 refresh_ui_data();
                 save_path = full_path.string();
+                watch_board_file();
                 std::cout << "Board successfully loaded from: " << full_path.string() << std::endl;
                 std::cout << "Board name set to: " << board_name << std::endl;
+            } catch (const BoardLoadError& e) {
+                // recover отключает слушателя на время загрузки - возвращаем прежний журнал
+                // или автосохранение
+                board->set_listener(journal.get());
+                if (!autosave_path.empty()) {
+                    autosave = std::make_unique<AutosaveService>(*board, autosave_path, autosave_delay, post_to_ui);
+                }
+                if (watching) {
+                    watch_board_file();
+                }
+                std::cout << "Error: Invalid board file format: " << e.what() << std::endl;
+                return;
             } catch (const std::exception& e) {
+                board->set_listener(journal.get());
+                if (!autosave_path.empty()) {
+                    autosave = std::make_unique<AutosaveService>(*board, autosave_path, autosave_delay, post_to_ui);
+                }
+                if (watching) {
+                    watch_board_file();
+                }
                 std::cout << "Error loading board: " << e.what() << std::endl;
                 return;
             }
@@ -541,16 +615,30 @@ void ScrumBoardUI::handle_save_load_dialog(bool is_save, const std::string& new_
 
 // Отрисовка доски в виде колонок с задачами
 // Создает визуальное представление Scrum доски
-Element ScrumBoardUI::render_board() {
+// Элементы строятся только для задач, которые помещаются в колонку: кадр стоит
+// O(высоты терминала), а не O(числа задач на доске)
+Element ScrumBoardUI::render_board(bool focused) {
     Elements column_elements;
     auto text_color = get_text_color();
+    const auto& columns = board->get_columns();
+    
+    // Окна и области колонок по позиции колонки; reflect заполняет область при отрисовке,
+    // поэтому размер векторов не меняется до конца кадра
+    column_viewports.resize(columns.size());
+    column_boxes.resize(columns.size());
+    focused_board_column = std::clamp(focused_board_column, 0, std::max(0, static_cast<int>(columns.size()) - 1));
     
     // Проходим по всем колонкам доски
-    for (const auto& column : board->get_columns()) {
+    for (size_t c = 0; c < columns.size(); ++c) {
+        const auto& column = columns[c];
         Elements task_elements;
         
-        // Заголовок колонки с названием
-        task_elements.push_back(text(column->get_name()) | bold | center | color(text_color));
+        // Заголовок колонки с названием; колонка, которую прокручивают клавиши, выделена
+        auto header = text(std::string(column->get_name())) | bold | center | color(text_color);
+        if (focused && static_cast<int>(c) == focused_board_column) {
+            header = header | inverted;
+        }
+        task_elements.push_back(header);
         // Разделительная линия под заголовком
         task_elements.push_back(separator());
         
@@ -581,12 +669,22 @@ Element ScrumBoardUI::render_board() {
                 case 0: task_height = 3; break; // Ультра-компактная - только заголовок
             }
             
-            // Отрисовка каждой задачи в колонке
-            for (size_t i = 0; i < tasks.size(); ++i) {
-                const auto& task = tasks[i];
+            // ОКНО КОЛОНКИ:
+            // Высота берется из области колонки в прошлом кадре за вычетом рамки,
+            // заголовка, разделителя и строки позиции; в первом кадре - из размера терминала
+            const Box& box = column_boxes[c];
+            int height = box.y_max > box.y_min ? box.y_max - box.y_min + 1 - 5
+                                               : Terminal::Size().dimy - board_chrome_height;
+            size_t rows = std::max(1, height / task_height);
+            ColumnViewport& viewport = column_viewports[c];
+            std::vector<const Task*> visible = viewport.visible_tasks(*column, rows);
+            
+            // Отрисовка видимых задач колонки
+            for (size_t i = 0; i < visible.size(); ++i) {
+                const Task* task = visible[i];
                 
-                // Получение имени разработчика
-                std::string developer_name = "Unassigned";
+                // Получение имени разработчика (без копирования строки)
+                std::string_view developer_name = "Unassigned";
                 if (task->get_developer()) {
                     developer_name = task->get_developer()->get_name();
                 }
@@ -594,12 +692,12 @@ Element ScrumBoardUI::render_board() {
                 Elements task_content;
                 
                 // ЗАГОЛОВОК ЗАДАЧИ - отображается всегда
-                task_content.push_back(text("📝 " + task->get_title()) | bold | center | color(text_color));
+                task_content.push_back(text("📝 " + std::string(task->get_title())) | bold | center | color(text_color));
                 
                 // УРОВЕНЬ 1+: Разработчик
                 if (detail_level >= 1 && task->get_developer()!=nullptr) {
                     task_content.push_back(separator()); // Разделитель
-                    task_content.push_back(text("👨 " + developer_name) | center | color(text_color));
+                    task_content.push_back(text("👨 " + std::string(developer_name)) | center | color(text_color));
                 }
                 
                 // УРОВЕНЬ 2+: Приоритет
@@ -609,10 +707,15 @@ Element ScrumBoardUI::render_board() {
                 
                 // УРОВЕНЬ 3+: Описание (если есть)
                 if (detail_level >= 3 && !task->get_description().empty()) {
-                    std::string desc = task->get_description();
-                    // Обрезаем длинные описания
-                    if (desc.length() > 20) desc = desc.substr(0, 17) + "...";
-                    task_content.push_back(text("📋 " + desc) | center | color(text_color));
+                    std::string_view desc = task->get_description();
+                    // Обрезаем длинные описания (substr у string_view не копирует данные)
+                    std::string line = "📋 ";
+                    if (desc.length() > 20) {
+                        line.append(desc.substr(0, 17)).append("...");
+                    } else {
+                        line.append(desc);
+                    }
+                    task_content.push_back(text(line) | center | color(text_color));
                 }
                 
                 // Создание элемента задачи
@@ -623,7 +726,15 @@ Element ScrumBoardUI::render_board() {
                 task_elements.push_back(task_element);
                 
                 // Добавляем отступ между задачами (кроме последней)
-                if (i < tasks.size() - 1) task_elements.push_back(filler());
+                if (i < visible.size() - 1) task_elements.push_back(filler());
+            }
+            
+            // Строка позиции вместо полосы прокрутки: видимые задачи из всех
+            if (visible.size() < tasks.size()) {
+                size_t first = viewport.get_offset() + 1;
+                task_elements.push_back(filler());
+                task_elements.push_back(text(std::to_string(first) + "-" + std::to_string(first + visible.size() - 1) +
+                                             " / " + std::to_string(tasks.size())) | dim | center | color(text_color));
             }
         }
         
@@ -633,8 +744,7 @@ Element ScrumBoardUI::render_board() {
             vbox(std::move(task_elements)) 
             | border        // Рамка вокруг колонки
             | flex          // Растягивается по вертикали
-            | frame         // Обрамление
-            | vscroll_indicator // Индикатор прокрутки если контент не помещается
+            | reflect(column_boxes[c]) // Область колонки - для высоты окна и мыши в следующем кадре
         );
     }
     
@@ -642,7 +752,8 @@ Element ScrumBoardUI::render_board() {
     // Простой и эффективный способ занять всю ширину
     return vbox({
         // Заголовок доски
-        text("SCRUM Board - " + board->get_name()) | bold | hcenter | color(text_color),
+        // "*" - есть изменения, еще не записанные на диск
+        text("SCRUM Board - " + std::string(board->get_name()) + (has_unsaved_changes() ? " *" : "")) | bold | hcenter | color(text_color),
         // Разделитель
         separator(),
         // Горизонтальное расположение колонок
@@ -654,12 +765,67 @@ Element ScrumBoardUI::render_board() {
     | xflex; // Занимает всю ширину терминала
 }
 
+// Прокрутка колонок доски
+// Стрелки у края доски или колонки не обрабатываются - фокус переходит к соседним элементам
+bool ScrumBoardUI::handle_board_event(Event event) {
+    const auto& columns = board->get_columns();
+    if (columns.empty() || column_viewports.size() != columns.size()) {
+        return false;  // Доска еще не отрисована с текущими колонками
+    }
+    auto scroll = [&](size_t c, std::ptrdiff_t delta) {
+        return column_viewports[c].scroll(delta, columns[c]->get_tasks().size());
+    };
+    
+    // Колесо мыши прокручивает колонку под курсором
+    if (event.is_mouse()) {
+        const Mouse& mouse = event.mouse();
+        if (mouse.button != Mouse::WheelUp && mouse.button != Mouse::WheelDown) {
+            return false;
+        }
+        for (size_t c = 0; c < column_boxes.size(); ++c) {
+            if (column_boxes[c].Contain(mouse.x, mouse.y)) {
+                focused_board_column = static_cast<int>(c);
+                scroll(c, mouse.button == Mouse::WheelUp ? -1 : 1);
+                return true;
+            }
+        }
+        return false;
+    }
+    
+    size_t c = std::min(static_cast<size_t>(std::max(focused_board_column, 0)), columns.size() - 1);
+    std::ptrdiff_t page = static_cast<std::ptrdiff_t>(column_viewports[c].get_rows());
+    std::ptrdiff_t all = static_cast<std::ptrdiff_t>(columns[c]->get_tasks().size());
+    if (event == Event::ArrowLeft) {
+        if (c == 0) {
+            return false;
+        }
+        focused_board_column = static_cast<int>(c) - 1;
+        return true;
+    }
+    if (event == Event::ArrowRight) {
+        if (c + 1 >= columns.size()) {
+            return false;
+        }
+        focused_board_column = static_cast<int>(c) + 1;
+        return true;
+    }
+    if (event == Event::ArrowUp) return scroll(c, -1);
+    if (event == Event::ArrowDown) return scroll(c, 1);
+    if (event == Event::PageUp) return scroll(c, -page);
+    if (event == Event::PageDown) return scroll(c, page);
+    if (event == Event::Home) return scroll(c, -all);
+    if (event == Event::End) return scroll(c, all);
+    return false;
+}
+
 // Основной метод запуска приложения
 // Создает UI и запускает главный цикл обработки событий
 void ScrumBoardUI::run() {
     // Создание интерактивного экрана
     // Fullscreen - занимает весь терминал
     auto screen = ScreenInteractive::Fullscreen();
+    // Автосохранение снимает копию доски в потоке UI, между обработкой событий
+    post_to_ui = [&screen](std::function<void()> task) { screen.Post(std::move(task)); };
     
     // Переменные состояния UI для диалоговых окон
     int active_component = 2;  // 0: main, 1: file dialog, 2: startup
@@ -719,7 +885,13 @@ void ScrumBoardUI::run() {
     // Кнопка создания новой доски
     auto new_board_btn = Button("Create New Board", [&] {
         // Создаем совершенно новую доску
+        // Наблюдатель, журнал и автосохранение старой доски отключаются до ее уничтожения
+        watcher.reset();
+        journal.reset();
+        autosave.reset();
         board = std::make_shared<Board>("ScrumBoard");
+        board->enable_arena();
+        column_viewports.clear();
         initialize_board(); // Инициализируем стандартными колонками
         active_component = 0; // Переходим к главному интерфейсу
         std::cout << "Created new empty board" << std::endl;
@@ -950,8 +1122,11 @@ void ScrumBoardUI::run() {
     });
 
     // Рендерер для отображения доски
-    auto board_renderer = Renderer([this] { 
-        return render_board(); 
+    // Фокусируемый, чтобы получать клавиши прокрутки колонок
+    auto board_renderer = Renderer([this](bool focused) { 
+        return render_board(focused); 
+    }) | CatchEvent([this](Event event) {
+        return handle_board_event(event);
     });
 
     // Рендерер для вкладки создания задач
@@ -1112,4 +1287,9 @@ void ScrumBoardUI::run() {
     // Запуск основного цикла приложения
     // Loop обрабатывает ввод пользователя и перерисовывает экран
     screen.Loop(final_renderer);
+    
+    // Последние изменения записываются до того, как экран перестанет принимать задачи
+    watcher.reset();
+    autosave.reset();
+    post_to_ui = nullptr;
 }
\ No newline at end of file
@@ -0,0 +1,122 @@
+#include "id_allocator.h"
+#include <stdexcept>
+
+namespace {
+
+// Генератор потока вместе с версией зерна, которой он инициализирован
+struct ThreadGenerator {
+    std::mt19937_64 engine;
+    uint64_t epoch = UINT64_MAX;  // Несуществующая версия - генератор еще не инициализирован
+};
+
+} // namespace
+
+IdAllocator& IdAllocator::instance() {
+    static IdAllocator allocator;
+    return allocator;
+}
+
+// Вызывается под mutex, поэтому seed и seed_epoch читаются безопасно
+std::mt19937_64& IdAllocator::generator() {
+    thread_local ThreadGenerator local;
+    if (local.epoch != seed_epoch) {
+        if (seeded) {
+            local.engine.seed(seed);
+        } else {
+            // std::random_device дорогой, поэтому обращаемся к нему один раз на поток
+            std::random_device rd;
+            local.engine.seed((static_cast<uint64_t>(rd()) << 32) ^ rd());
+        }
+        local.epoch = seed_epoch;
+    }
+    return local.engine;
+}
+
+// Выделение нового уникального ID
+TaskId IdAllocator::allocate(std::size_t length) {
+    if (length == 0 || length > TaskId::max_packed_length) {
+        throw std::invalid_argument("Task ID length must be between 1 and 10");
+    }
+
+    // Количество различных ID заданной длины: 62^length
+    uint64_t capacity = 1;
+    for (std::size_t i = 0; i < length; ++i) {
+        capacity *= 62;
+    }
+    std::uniform_int_distribution<uint64_t> distribution(0, capacity - 1);
+
+    // Максимальное количество попыток генерации
+    // Защита от бесконечного цикла если пространство ID почти исчерпано
+    const int max_attempts = 100;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto& engine = generator();
+    for (int attempt = 0; attempt < max_attempts; ++attempt) {
+        // ID - это одно случайное число, упакованное вместе с длиной
+        TaskId candidate = TaskId::from_base62(distribution(engine), length);
+
+        // Проверка уникальности - одна операция с хеш-таблицей
+        if (used.emplace(candidate, 1).second) {
+            return candidate;
+        }
+    }
+    throw std::runtime_error("Failed to generate unique task ID");
+}
+
+// Регистрация существующего ID
+void IdAllocator::reserve(TaskId id) {
+    if (!id.valid()) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    ++used[id];
+}
+
+// Резерв места в таблице
+void IdAllocator::prepare(std::size_t extra) {
+    std::lock_guard<std::mutex> lock(mutex);
+    used.reserve(used.size() + extra);
+}
+
+// Освобождение ID
+void IdAllocator::release(TaskId id) {
+    if (!id.valid()) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = used.find(id);
+    if (it != used.end() && --it->second == 0) {
+        used.erase(it);
+    }
+}
+
+bool IdAllocator::contains(TaskId id) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return used.count(id) != 0;
+}
+
+std::size_t IdAllocator::size() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return used.size();
+}
+
+void IdAllocator::clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    used.clear();
+}
+
+// Установка фиксированного зерна
+// Все потоки пересоздадут свои генераторы при следующем выделении ID
+void IdAllocator::set_seed(uint64_t s) {
+    std::lock_guard<std::mutex> lock(mutex);
+    seeded = true;
+    seed = s;
+    ++seed_epoch;
+}
+
+// Возврат к случайному зерну из std::random_device
+void IdAllocator::clear_seed() {
+    std::lock_guard<std::mutex> lock(mutex);
+    seeded = false;
+    ++seed_epoch;
+}
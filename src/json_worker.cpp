@@ -1,18 +1,817 @@
 #include <rapidjson/document.h>
 #include <rapidjson/prettywriter.h>
 #include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+#include <rapidjson/filewritestream.h>
+#include <rapidjson/filereadstream.h>
+#include <rapidjson/reader.h>
+#include <rapidjson/error/en.h>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <exception>
+#include <filesystem>
 #include <iostream>
 #include <fstream>
-#include <sstream>
 #include <algorithm>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
+#include <thread>
 #include "json_worker.h"
 #include "board.h"
+#include "board_loader.h"
+#include "board_snapshot.h"
+#include "mapped_file.h"
+#include "parallel_for.h"
 #include "task.h"
+#include "written_files.h"
+#if !defined(_WIN32)
+#include <unistd.h>
+#endif
 
 using namespace rapidjson;
 
+namespace {
+
+// Создание JSON строки из std::string_view (строка копируется аллокатором документа)
+Value make_string(std::string_view text, Document::AllocatorType& allocator) {
+    return Value(text.data(), static_cast<SizeType>(text.size()), allocator);
+}
+
+// Запись строки через SAX-писатель
+template <typename Writer>
+void write_string(Writer& writer, std::string_view text) {
+    writer.String(text.data(), static_cast<SizeType>(text.size()));
+}
+
+template <typename Writer>
+void write_key(Writer& writer, std::string_view text) {
+    writer.Key(text.data(), static_cast<SizeType>(text.size()));
+}
+
+// Запись задачи - члена объекта колонки с ключом-заголовком
+template <typename Writer>
+void write_task(Writer& writer, const Task& task) {
+    write_key(writer, task.get_title());
+    writer.StartObject();
+    writer.Key("description");
+    write_string(writer, task.get_description());
+    writer.Key("id");
+    write_string(writer, task.get_id());
+    writer.Key("priority");
+    writer.Int(task.get_priority());
+    writer.Key("developer");
+    Developer* developer = task.get_developer();
+    write_string(writer, developer ? developer->get_name() : std::string_view("Unassigned"));
+    writer.EndObject();
+}
+
+// Запись задач колонки - объекта, в котором ключи - заголовки задач
+template <typename Writer>
+void write_column(Writer& writer, const Column& column) {
+    writer.StartObject();
+    for (const auto& task_ptr : column.get_tasks()) {
+        write_task(writer, *task_ptr);
+    }
+    writer.EndObject();
+}
+
+// Писатель того же вида, что и писатель файла (с отступами или без), но в память
+template <typename FileWriter>
+struct BufferWriter {
+    using type = Writer<StringBuffer>;
+};
+
+template <typename Stream>
+struct BufferWriter<PrettyWriter<Stream>> {
+    using type = PrettyWriter<StringBuffer>;
+};
+
+// Кодирование части колонки - задач [first, last): ID задач (элементы массива ids
+// через разделители) и члены объекта задач - ровно в том виде, в каком их пишет write_board
+// Писатель проходит те же уровни вложенности, что и в файле, поэтому отступы совпадают
+// Первая часть (head) начинается с первого ID и открывающей скобки объекта задач,
+// остальные - с разделителя перед своим первым элементом: перед ними пишется пустой
+// элемент, который отрезается. Последняя часть (tail) закрывает объект задач
+// Склеенные по порядку части дают колонку целиком
+template <typename FileWriter>
+void encode_shard(TaskList::const_iterator first, TaskList::const_iterator last, bool head, bool tail,
+                  CachedColumn& encoded) {
+    StringBuffer buffer;
+    typename BufferWriter<FileWriter>::type writer(buffer);
+    writer.StartObject();
+    writer.Key("b");
+    writer.StartObject();
+    writer.Key("ids");
+    writer.StartArray();
+    if (!head) {
+        writer.String("");
+    }
+    std::size_t start = buffer.GetSize();
+    for (auto it = first; it != last; ++it) {
+        write_string(writer, (*it)->get_id());
+    }
+    std::string_view ids(buffer.GetString() + start, buffer.GetSize() - start);
+    // Разделитель перед первым элементом колонки пишет сам писатель файла
+    encoded.ids.assign(head ? ids.substr(std::min(ids.size(), ids.find('"'))) : ids);
+    writer.EndArray();
+    writer.Key("c");
+    start = buffer.GetSize();
+    writer.StartObject();
+    if (!head) {
+        writer.Key("");
+        writer.Null();
+        start = buffer.GetSize();
+    }
+    for (auto it = first; it != last; ++it) {
+        write_task(writer, **it);
+    }
+    if (tail) {
+        writer.EndObject();
+    }
+    std::string_view tasks(buffer.GetString() + start, buffer.GetSize() - start);
+    encoded.tasks.assign(head ? tasks.substr(tasks.find('{')) : tasks);
+}
+
+// Кодирование колонки целиком
+template <typename FileWriter>
+void encode_column(const Column& column, CachedColumn& cached) {
+    encode_shard<FileWriter>(column.get_tasks().begin(), column.get_tasks().end(), true, true, cached);
+}
+
+// Параллельное кодирование колонок: большие колонки делятся на части примерно
+// равного числа задач, части кодируются на threads потоках и склеиваются по порядку
+template <typename FileWriter>
+void encode_columns(const std::vector<const Column*>& columns, const std::vector<CachedColumn*>& encoded,
+                    unsigned threads) {
+    struct Shard {
+        std::size_t column;
+        TaskList::const_iterator first;
+        TaskList::const_iterator last;
+        bool head;
+        bool tail;
+        CachedColumn encoded;
+    };
+
+    std::size_t total = 0;
+    for (const Column* column : columns) {
+        total += column->get_tasks().size();
+    }
+    // Несколько частей на поток выравнивают нагрузку между потоками
+    const std::size_t shard_tasks = std::max<std::size_t>(4096, total / (std::size_t(threads) * 4) + 1);
+    std::vector<Shard> shards;
+    for (std::size_t c = 0; c < columns.size(); ++c) {
+        const TaskList& tasks = columns[c]->get_tasks();
+        auto first = tasks.begin();
+        std::size_t left = tasks.size();
+        do {
+            auto last = first;
+            std::size_t count = std::min(left, shard_tasks);
+            for (std::size_t i = 0; i < count; ++i) {
+                ++last;
+            }
+            left -= count;
+            shards.push_back({c, first, last, first == tasks.begin(), left == 0, {}});
+            first = last;
+        } while (left > 0);
+    }
+
+    parallel_for(shards.size(), threads, [&](std::size_t index, unsigned) {
+        Shard& shard = shards[index];
+        encode_shard<FileWriter>(shard.first, shard.last, shard.head, shard.tail, shard.encoded);
+    });
+
+    for (auto& shard : shards) {
+        CachedColumn& column = *encoded[shard.column];
+        if (shard.head) {
+            column.ids = std::move(shard.encoded.ids);
+            column.tasks = std::move(shard.encoded.tasks);
+        } else {
+            column.ids += shard.encoded.ids;
+            column.tasks += shard.encoded.tasks;
+        }
+    }
+}
+
+// Запись доски в SAX-писатель в том же порядке полей, что и board_add:
+// {"<доска>": {"ids": [...], "developers": [...], "<колонка>": {"<задача>": {...}}}}
+// С кешем колонки, ревизия которых не изменилась, пишутся готовыми байтами,
+// а остальные кодируются заново; в кеше остаются только колонки доски
+// При threads > 1 колонки кодируются параллельно (см. encode_columns) и пишутся
+// готовыми байтами так же, как из кеша
+template <typename Writer>
+void write_board(Writer& writer, const Board& board, ColumnCache* cache = nullptr, unsigned threads = 1) {
+    ColumnCache next;
+    std::vector<CachedColumn> local;
+    std::vector<const CachedColumn*> encoded;
+    const bool spliced = cache || threads > 1;
+    if (spliced) {
+        // Колонки, которых нет в кеше, собираются для кодирования
+        std::vector<const Column*> stale;
+        std::vector<CachedColumn*> targets;
+        if (!cache) {
+            local.resize(board.get_columns().size());
+        }
+        encoded.reserve(board.get_columns().size());
+        for (std::size_t c = 0; c < board.get_columns().size(); ++c) {
+            const Column* column = board.get_columns()[c].get();
+            CachedColumn* cached;
+            if (cache) {
+                cached = &next[column];
+                auto it = cache->find(column);
+                if (it != cache->end() && it->second.revision == column->get_revision()) {
+                    *cached = std::move(it->second);
+                    encoded.push_back(cached);
+                    continue;
+                }
+                cached->revision = column->get_revision();
+            } else {
+                cached = &local[c];
+            }
+            stale.push_back(column);
+            targets.push_back(cached);
+            encoded.push_back(cached);
+        }
+        if (threads > 1) {
+            encode_columns<Writer>(stale, targets, threads);
+        } else {
+            for (std::size_t i = 0; i < stale.size(); ++i) {
+                encode_column<Writer>(*stale[i], *targets[i]);
+            }
+        }
+    }
+
+    writer.StartObject();
+    write_key(writer, board.get_name());
+    writer.StartObject();
+
+    // ID всех задач для отслеживания уникальности при загрузке
+    writer.Key("ids");
+    writer.StartArray();
+    for (std::size_t c = 0; c < board.get_columns().size(); ++c) {
+        if (spliced) {
+            // ID колонки целиком - одним сырым значением со своими разделителями внутри
+            if (!encoded[c]->ids.empty()) {
+                writer.RawValue(encoded[c]->ids.data(), encoded[c]->ids.size(), kStringType);
+            }
+            continue;
+        }
+        for (const auto& task_ptr : board.get_columns()[c]->get_tasks()) {
+            write_string(writer, task_ptr->get_id());
+        }
+    }
+    writer.EndArray();
+
+    writer.Key("developers");
+    writer.StartArray();
+    for (const auto& d : board.get_developers()) {
+        write_string(writer, d->get_name());
+    }
+    writer.EndArray();
+
+    // Колонки - объекты, в которых ключи - заголовки задач
+    for (std::size_t c = 0; c < board.get_columns().size(); ++c) {
+        const Column& column = *board.get_columns()[c];
+        write_key(writer, column.get_name());
+        if (spliced) {
+            writer.RawValue(encoded[c]->tasks.data(), encoded[c]->tasks.size(), kObjectType);
+        } else {
+            write_column(writer, column);
+        }
+    }
+
+    writer.EndObject();
+    writer.EndObject();
+
+    if (cache) {
+        cache->swap(next);
+    }
+}
+
+// Запись снимка доски - поля и порядок те же, что у write_board
+template <typename Writer>
+void write_snapshot(Writer& writer, const BoardSnapshot& snapshot) {
+    writer.StartObject();
+    write_key(writer, snapshot.get(snapshot.name));
+    writer.StartObject();
+
+    writer.Key("ids");
+    writer.StartArray();
+    for (const auto& task : snapshot.tasks) {
+        write_string(writer, task.id.to_string());
+    }
+    writer.EndArray();
+
+    writer.Key("developers");
+    writer.StartArray();
+    for (std::size_t i = 0; i < snapshot.developer_count; ++i) {
+        write_string(writer, snapshot.get(snapshot.developer_names[i]));
+    }
+    writer.EndArray();
+
+    for (const auto& column : snapshot.columns) {
+        write_key(writer, snapshot.get(column.name));
+        writer.StartObject();
+        for (std::size_t t = column.first_task; t < column.first_task + column.task_count; ++t) {
+            const auto& task = snapshot.tasks[t];
+            write_key(writer, snapshot.get(task.title));
+            writer.StartObject();
+            writer.Key("description");
+            write_string(writer, snapshot.get(task.description));
+            writer.Key("id");
+            write_string(writer, task.id.to_string());
+            writer.Key("priority");
+            writer.Int(task.priority);
+            writer.Key("developer");
+            write_string(writer, task.developer != BoardSnapshot::no_developer
+                                     ? snapshot.get(snapshot.developer_names[task.developer])
+                                     : std::string_view("Unassigned"));
+            writer.EndObject();
+        }
+        writer.EndObject();
+    }
+
+    writer.EndObject();
+    writer.EndObject();
+}
+
+// Запись JSON в открытый файл с текущей позиции через буфер FileWriteStream
+template <typename F>
+void write_json_stream(std::FILE* file, bool pretty, F&& write) {
+    char buffer[64 * 1024];
+    FileWriteStream stream(file, buffer, sizeof(buffer));
+    if (pretty) {
+        PrettyWriter<FileWriteStream> writer(stream);
+        write(writer);
+    } else {
+        Writer<FileWriteStream> writer(stream);
+        write(writer);
+    }
+    stream.Flush();
+}
+
+// Запись JSON в файл path через временный файл "<path>.tmp" и переименование:
+// читатели видят либо старый файл целиком, либо новый
+// durable - сброс данных на диск (fsync) до переименования
+template <typename F>
+void write_json_file(const std::string& path, bool pretty, bool durable, F&& write) {
+    const std::string temp_path = path + ".tmp";
+    std::unique_ptr<std::FILE, int (*)(std::FILE*)> file(std::fopen(temp_path.c_str(), "w"), &std::fclose);
+    if (!file) {
+        throw std::runtime_error("Cannot open file for writing: " + path);
+    }
+
+    write_json_stream(file.get(), pretty, std::forward<F>(write));
+
+    // Ошибки записи проявляются только при сбросе буфера и закрытии файла
+    bool failed = std::fflush(file.get()) != 0 || std::ferror(file.get()) != 0;
+#if !defined(_WIN32)
+    if (durable && !failed) {
+        failed = ::fsync(::fileno(file.get())) != 0;
+    }
+#endif
+    failed = std::fclose(file.release()) != 0 || failed;
+    std::error_code error;
+    if (!failed) {
+        std::filesystem::rename(temp_path, path, error);
+    }
+    if (failed || error) {
+        std::remove(temp_path.c_str());
+        throw std::runtime_error("Cannot write file: " + path);
+    }
+    WrittenFiles::instance().record(path);
+}
+
+// Разбор JSON доски из потока в stage
+// Смещения в BoardLoadError считаются от base_offset - позиции начала потока в файле
+// handler - обработчик, строящий stage
+template <unsigned parse_flags, typename Stream>
+void parse_stage(Stream& stream, std::size_t base_offset, BoardStage& stage, BoardLoadHandler& handler) {
+    ArenaScope arena_scope(stage.arena.get());
+    Reader reader;
+    ParseResult result = reader.Parse<parse_flags>(stream, handler);
+    
+    // Ошибка модели важнее ошибки разбора
+    if (handler.get_error()) {
+        std::rethrow_exception(handler.get_error());
+    }
+    if (handler.get_structure_error()) {
+        throw BoardLoadError(handler.get_structure_error(), base_offset + result.Offset());
+    }
+    if (result.IsError()) {
+        throw BoardLoadError(std::string("Invalid JSON format: ") + GetParseError_En(result.Code()),
+                             base_offset + result.Offset());
+    }
+    handler.finish();
+}
+
+// Разбор файла доски в stage за одно чтение и один разбор
+// В режиме Mapped файл отображается в память и разбирается на месте: строки задач
+// читаются прямо из отображения и копируются один раз, в саму задачу
+// В режиме Stream файл читается блоками через FileReadStream
+// Ошибки модели (например, неверный приоритет) пробрасываются как есть,
+// ошибки структуры и синтаксиса - как BoardLoadError со смещением
+void load_stage(const std::string& path, LoadMode mode, BoardStage& stage) {
+    // Открываем файл до разбора, чтобы ошибка открытия не зависела от режима
+    std::unique_ptr<MappedFile> mapped;
+    std::unique_ptr<std::FILE, int (*)(std::FILE*)> file(nullptr, &std::fclose);
+    if (mode == LoadMode::Mapped) {
+        mapped = std::make_unique<MappedFile>(path);
+    } else {
+        file.reset(std::fopen(path.c_str(), "rb"));
+        if (!file) {
+            throw std::runtime_error("Cannot open file: " + path);
+        }
+    }
+    
+    if (mapped) {
+        InsituStringStream stream(mapped->data());
+        BoardLoadHandler handler(stage);
+        parse_stage<kParseInsituFlag>(stream, 0, stage, handler);
+    } else {
+        char buffer[64 * 1024];
+        FileReadStream stream(file.get(), buffer, sizeof(buffer));
+        BoardLoadHandler handler(stage);
+        parse_stage<kParseDefaultFlags>(stream, 0, stage, handler);
+    }
+}
+
+
+// Тело колонки в файле - объект задач [begin, end) и точки деления на части
+// Часть i занимает [starts[i], ends[i]): от ключа первой задачи до конца последней,
+// у первой части start - открывающая скобка, у последней end - конец тела
+struct ColumnBody {
+    char* begin;
+    char* end;
+    std::vector<char*> starts;
+    std::vector<char*> ends;
+    bool has_members = false;
+};
+
+// Быстрый проход по файлу без разбора значений: поиск тел колонок первой доски
+// и границ между задачами примерно через shard_bytes байт
+// Проверяется только то, что нужно для деления; значения проверит разбор частей,
+// а остальной файл - разбор скелета. false - файл не подходит для деления
+// (необычная структура, экранирование в ключах доски) и читается последовательно
+class BoardScanner {
+private:
+    char* p;
+    char* end;
+
+    void whitespace() {
+        while (p != end && (*p == ' ' || *p == '\n' || *p == '\r' || *p == '\t')) {
+            ++p;
+        }
+    }
+
+    bool expect(char c) {
+        whitespace();
+        if (p == end || *p != c) {
+            return false;
+        }
+        ++p;
+        return true;
+    }
+
+    // Пропуск строки: p на открывающей кавычке; кавычка экранирована, если перед ней
+    // нечетное число '\'
+    bool string() {
+        char* from = ++p;
+        for (;;) {
+            auto* quote = static_cast<char*>(std::memchr(p, '"', static_cast<std::size_t>(end - p)));
+            if (!quote) {
+                return false;
+            }
+            char* slash = quote;
+            while (slash > from && slash[-1] == '\\') {
+                --slash;
+            }
+            p = quote + 1;
+            if ((quote - slash) % 2 == 0) {
+                return true;
+            }
+        }
+    }
+
+    // Пропуск значения с подсчетом скобок
+    bool value() {
+        whitespace();
+        int depth = 0;
+        while (p != end) {
+            char c = *p;
+            if (c == '"') {
+                if (!string()) {
+                    return false;
+                }
+                if (depth == 0) {
+                    return true;
+                }
+                continue;
+            }
+            if (c == '{' || c == '[') {
+                ++depth;
+            } else if (c == '}' || c == ']') {
+                if (depth == 0) {
+                    return true;
+                }
+                if (--depth == 0) {
+                    ++p;
+                    return true;
+                }
+            } else if (depth == 0 && (c == ',' || c == ' ' || c == '\n' || c == '\r' || c == '\t')) {
+                return true;
+            }
+            ++p;
+        }
+        return depth == 0;
+    }
+
+    // Тело колонки: члены объекта задач с делением на части
+    bool body(std::size_t shard_bytes, ColumnBody& column) {
+        column.begin = p++;
+        column.starts.push_back(column.begin);
+        whitespace();
+        while (p == end || *p != '}') {
+            whitespace();
+            if (p == end || *p != '"' || !string() || !expect(':') || !value()) {
+                return false;
+            }
+            char* member_end = p;
+            column.has_members = true;
+            whitespace();
+            if (p != end && *p == '}') {
+                break;
+            }
+            if (p == end || *p != ',') {
+                return false;
+            }
+            ++p;
+            whitespace();
+            if (p == end || *p != '"') {
+                return false;
+            }
+            // Часть набрала shard_bytes - следующая начинается со следующего члена
+            if (p - column.starts.back() >= static_cast<std::ptrdiff_t>(shard_bytes)) {
+                column.ends.push_back(member_end);
+                column.starts.push_back(p);
+            }
+        }
+        column.end = ++p;
+        column.ends.push_back(column.end);
+        return true;
+    }
+
+public:
+    BoardScanner(char* data, std::size_t size) : p(data), end(data + size) {}
+
+    bool scan(std::size_t shard_bytes, std::vector<ColumnBody>& bodies) {
+        // Корень - объект, первый член - объект доски
+        if (!expect('{')) {
+            return false;
+        }
+        whitespace();
+        if (p == end || *p != '"' || !string() || !expect(':') || !expect('{')) {
+            return false;
+        }
+        whitespace();
+        if (p != end && *p == '}') {
+            return true;
+        }
+        for (;;) {
+            whitespace();
+            char* key = p;
+            if (p == end || *p != '"' || !string()) {
+                return false;
+            }
+            std::string_view name(key + 1, static_cast<std::size_t>(p - key - 2));
+            if (name.find('\\') != std::string_view::npos || !expect(':')) {
+                return false;
+            }
+            whitespace();
+            if (p != end && *p == '{' && name != "ids" && name != "developers") {
+                bodies.emplace_back();
+                if (!body(shard_bytes, bodies.back())) {
+                    return false;
+                }
+            } else if (!value()) {
+                return false;
+            }
+            whitespace();
+            if (p == end) {
+                return false;
+            }
+            if (*p == '}') {
+                return true;
+            }
+            if (*p != ',') {
+                return false;
+            }
+            ++p;
+        }
+    }
+};
+
+// Поток разбора на месте, который перескакивает тела колонок: каждое тело читается
+// как пустой объект (его '{', затем сразу его '}'). Смещения - от начала файла
+class SkeletonStream {
+private:
+    char* src;
+    char* dst = nullptr;
+    char* head;
+    const std::vector<ColumnBody>& bodies;
+    std::size_t next_body = 0;
+
+public:
+    using Ch = char;
+
+    SkeletonStream(char* data, const std::vector<ColumnBody>& b) : src(data), head(data), bodies(b) {}
+
+    Ch Peek() const { return *src; }
+    Ch Take() {
+        if (next_body < bodies.size() && src == bodies[next_body].begin) {
+            src = bodies[next_body++].end - 1;
+            return '{';
+        }
+        return *src ? *src++ : '\0';
+    }
+    std::size_t Tell() const { return static_cast<std::size_t>(src - head); }
+
+    Ch* PutBegin() { return dst = src; }
+    void Put(Ch c) { *dst++ = c; }
+    void Flush() {}
+    Ch* Push(std::size_t count) { Ch* begin = dst; dst += count; return begin; }
+    void Pop(std::size_t count) { dst -= count; }
+    std::size_t PutEnd(Ch* begin) { return static_cast<std::size_t>(dst - begin); }
+};
+
+// Поток разбора на месте для части тела колонки [begin, end): части без своих скобок
+// получают их виртуально, за концом части - '\0'. Смещения - от начала файла
+class FragmentStream {
+private:
+    char* src;
+    char* dst = nullptr;
+    char* head;
+    char* end;
+    bool open;   // Виртуальная '{' перед частью еще не прочитана
+    bool close;  // Виртуальная '}' после части еще не прочитана
+
+public:
+    using Ch = char;
+
+    FragmentStream(char* data, char* begin, char* e, bool o, bool c)
+        : src(begin), head(data), end(e), open(o), close(c) {}
+
+    Ch Peek() const {
+        if (open) {
+            return '{';
+        }
+        if (src != end) {
+            return *src;
+        }
+        return close ? '}' : '\0';
+    }
+    Ch Take() {
+        Ch c = Peek();
+        if (open) {
+            open = false;
+        } else if (src != end) {
+            ++src;
+        } else {
+            close = false;
+        }
+        return c;
+    }
+    std::size_t Tell() const { return static_cast<std::size_t>(src - head); }
+
+    Ch* PutBegin() { return dst = src; }
+    void Put(Ch c) { *dst++ = c; }
+    void Flush() {}
+    Ch* Push(std::size_t count) { Ch* begin = dst; dst += count; return begin; }
+    void Pop(std::size_t count) { dst -= count; }
+    std::size_t PutEnd(Ch* begin) { return static_cast<std::size_t>(dst - begin); }
+};
+
+// Очистка stage перед повторной загрузкой; объекты удаляются раньше своих арен
+void reset_stage(BoardStage& stage) {
+    stage.columns.clear();
+    stage.developers.clear();
+    stage.ids.clear();
+    stage.board_name.clear();
+    if (stage.arena) {
+        stage.arena = std::make_unique<BoardArena>();
+    }
+}
+
+// Параллельная загрузка файла доски на threads потоках
+// 1. BoardScanner находит тела колонок и делит большие тела на части
+// 2. Скелет (все, кроме тел) разбирается последовательно: название, ids, разработчики,
+//    колонки и проверка структуры вне тел
+// 3. Части тел разбираются параллельно, у каждого потока своя арена
+// 4. Задачи добавляются в колонки по порядку, колонки - параллельно
+// Любая ошибка (или файл, который не делится) - повторная последовательная загрузка,
+// поэтому результат и ошибки совпадают с последовательным путем
+void load_stage_parallel(const std::string& path, unsigned threads, BoardStage& stage) {
+    auto mapped = std::make_unique<MappedFile>(path);
+    // Несколько частей на поток выравнивают нагрузку между потоками
+    const std::size_t shard_bytes = std::max<std::size_t>(256 * 1024, mapped->size() / (std::size_t(threads) * 4));
+    std::vector<ColumnBody> bodies;
+    if (!BoardScanner(mapped->data(), mapped->size()).scan(shard_bytes, bodies)) {
+        load_stage(path, LoadMode::Mapped, stage);
+        return;
+    }
+
+    BoardLoadHandler skeleton(stage);
+    bool ok = true;
+    try {
+        for (const auto& body : bodies) {
+            if (body.has_members) {
+                skeleton.assume_content();
+                break;
+            }
+        }
+        SkeletonStream stream(mapped->data(), bodies);
+        parse_stage<kParseInsituFlag>(stream, 0, stage, skeleton);
+        ok = skeleton.get_object_columns().size() == bodies.size();
+    } catch (const std::exception&) {
+        ok = false;
+    }
+
+    struct Shard {
+        std::size_t body;
+        char* begin;
+        char* end;
+        bool open;
+        bool close;
+        std::vector<std::unique_ptr<Task>> tasks;
+    };
+    std::vector<Shard> shards;
+    std::vector<std::unique_ptr<BoardArena>> arenas(threads);
+    if (ok) {
+        for (std::size_t b = 0; b < bodies.size(); ++b) {
+            const ColumnBody& body = bodies[b];
+            for (std::size_t i = 0; i < body.starts.size(); ++i) {
+                shards.push_back({b, body.starts[i], body.ends[i], i != 0, i + 1 != body.starts.size(), {}});
+            }
+        }
+        if (stage.arena) {
+            for (auto& arena : arenas) {
+                arena = std::make_unique<BoardArena>();
+            }
+        }
+        std::atomic<bool> failed{false};
+        parallel_for(shards.size(), threads, [&](std::size_t index, unsigned worker) {
+            if (failed) {
+                return;
+            }
+            Shard& shard = shards[index];
+            ArenaScope arena_scope(arenas[worker].get());
+            BoardLoadHandler handler(stage, skeleton, shard.tasks);
+            FragmentStream stream(mapped->data(), shard.begin, shard.end, shard.open, shard.close);
+            Reader reader;
+            ParseResult result = reader.Parse<kParseInsituFlag>(stream, handler);
+            if (result.IsError() || handler.get_error() || handler.get_structure_error()) {
+                failed = true;
+            }
+        });
+        ok = !failed;
+    }
+
+    // Задачи частей переходят в колонки; арены потоков - в арену доски
+    if (ok) {
+        try {
+            std::vector<std::vector<Shard*>> by_body(bodies.size());
+            for (auto& shard : shards) {
+                by_body[shard.body].push_back(&shard);
+            }
+            parallel_for(bodies.size(), threads, [&](std::size_t b, unsigned) {
+                Column* column = skeleton.get_object_columns()[b];
+                for (Shard* shard : by_body[b]) {
+                    for (auto& task : shard->tasks) {
+                        column->add_task(std::move(task));
+                    }
+                }
+            });
+            skeleton.finish();
+        } catch (const std::exception&) {
+            ok = false;
+        }
+    }
+    if (stage.arena) {
+        for (auto& arena : arenas) {
+            stage.arena->adopt(std::move(arena));
+        }
+    }
+    if (!ok) {
+        // Задачи частей удаляются до повторной загрузки
+        shards.clear();
+        reset_stage(stage);
+        mapped.reset();
+        load_stage(path, LoadMode::Mapped, stage);
+    }
+}
+} // namespace
+
 // Сохранение JSON документа в файл
 void Json_worker::save() {
     // Создание буфера и писателя для форматированного вывода
@@ -35,15 +834,16 @@ void Json_worker::save() {
 }
 
 // Создание JSON массива из вектора ID задач
-Value Json_worker::ids_add(const std::vector<std::string>& id) {
+Value Json_worker::ids_add(const std::vector<TaskId>& id) {
     // Создаем JSON массив для хранения ID
     Value ids_array(kArrayType);
     
     // Добавление каждого ID в JSON массив
     for (const auto& elem : id) {
         Value id_value;
-        // Преобразуем строку ID в JSON строку
-        id_value.SetString(elem.c_str(), static_cast<rapidjson::SizeType>(elem.length()), allocator);
+        // Текстовое представление base62 строится только здесь, при записи в JSON
+        std::string text = elem.to_string();
+        id_value.SetString(text.c_str(), static_cast<rapidjson::SizeType>(text.length()), allocator);
         // Добавляем ID в массив
         ids_array.PushBack(id_value, allocator);
     }
@@ -58,10 +858,8 @@ void Json_worker::board_add(const Board& board, Value ids) {
     Value developers_json(kArrayType);
     
     // Добавление названия доски в JSON
-    std::string current_board_name = board.get_name();
-    Value board_name;
     // Копируем строку названия доски в JSON значение
-    board_name.SetString(current_board_name.c_str(), current_board_name.length(), allocator);
+    Value board_name = make_string(board.get_name(), allocator);
 
     // Добавление ID задач в объект доски
     // Это нужно для отслеживания уникальности ID при загрузке
@@ -70,7 +868,7 @@ void Json_worker::board_add(const Board& board, Value ids) {
     // Добавление разработчиков в массив
     for (const auto& d : board.get_developers()) {
         // Для каждого разработчика добавляем его имя в массив
-        developers_json.PushBack(Value(d->get_name().c_str(), allocator), allocator);
+        developers_json.PushBack(make_string(d->get_name(), allocator), allocator);
     }
     // Добавляем массив разработчиков в объект доски
     board_json.AddMember("developers", developers_json, allocator);
@@ -80,9 +878,8 @@ void Json_worker::board_add(const Board& board, Value ids) {
         // Создаем объект для задач текущей колонки
         // Ключи - названия задач, значения - объекты с данными задач
         Value tasks_json(kObjectType);
-        Value column_name;
         // Копируем название колонки в JSON значение
-        column_name.SetString(column_ptr->get_name().c_str(), column_ptr->get_name().length(), allocator);
+        Value column_name = make_string(column_ptr->get_name(), allocator);
         
         // Добавление каждой задачи в колонке
         for (const auto& task_ptr : column_ptr->get_tasks()) {
@@ -90,23 +887,20 @@ void Json_worker::board_add(const Board& board, Value ids) {
             Value task_data(kObjectType);
             
             // Добавление полей задачи в объект
-            task_data.AddMember("description", Value(task_ptr->get_description().c_str(), allocator), allocator);
+            task_data.AddMember("description", make_string(task_ptr->get_description(), allocator), allocator);
             task_data.AddMember("id", Value(task_ptr->get_id().c_str(), allocator), allocator);
             task_data.AddMember("priority", task_ptr->get_priority(), allocator);
             
             // Добавление разработчика (или "Unassigned" если не назначен)
             if (task_ptr->get_developer()) {
-                task_data.AddMember("developer", Value(task_ptr->get_developer()->get_name().c_str(), allocator), allocator);
+                task_data.AddMember("developer", make_string(task_ptr->get_developer()->get_name(), allocator), allocator);
             } else {
                 task_data.AddMember("developer", Value("Unassigned", allocator), allocator);
             }
 
             // Использование заголовка задачи как ключа в JSON объекте
             // Это позволяет легко находить задачи по названию при загрузке
-            Value task_title;
-            task_title.SetString(task_ptr->get_title().c_str(), 
-                               static_cast<rapidjson::SizeType>(task_ptr->get_title().length()), 
-                               allocator);
+            Value task_title = make_string(task_ptr->get_title(), allocator);
             // Добавляем задачу в объект задач колонки
             tasks_json.AddMember(task_title, task_data, allocator);
         }
@@ -118,25 +912,71 @@ void Json_worker::board_add(const Board& board, Value ids) {
     doc.AddMember(board_name, board_json, allocator);
 }
 
+// Потоковое сохранение доски
+// Данные идут из Board через буфер FileWriteStream прямо в файл:
+// нет ни DOM-копии доски, ни строки со всем JSON в памяти
+// Неизмененная с прошлого сохранения доска не пишется повторно
+bool Json_worker::board_save(const Board& board, bool pretty) {
+    if (saved_board == &board && saved_revision == board.get_revision() && saved_pretty == pretty &&
+        std::filesystem::exists(save_path)) {
+        std::cout << "Board is unchanged since last save: " << save_path << std::endl;
+        return false;
+    }
+    // Кеш колонок действителен только для того же вида вывода
+    if (column_cache_enabled && saved_pretty != pretty) {
+        column_cache.clear();
+    }
+    ColumnCache* cache = column_cache_enabled ? &column_cache : nullptr;
+    write_json_file(save_path, pretty, false, [&](auto& writer) { write_board(writer, board, cache, threads); });
+    saved_board = &board;
+    saved_revision = board.get_revision();
+    saved_pretty = pretty;
+    std::cout << "Board saved successfully to: " << save_path << std::endl;
+    return true;
+}
+
+// Сохранение снимка доски (обычно из фонового потока)
+void Json_worker::snapshot_save(const BoardSnapshot& snapshot, bool pretty) {
+    write_json_file(save_path, pretty, true, [&](auto& writer) { write_snapshot(writer, snapshot); });
+}
+
+// Число потоков параллельного режима
+void Json_worker::set_threads(unsigned count) {
+    threads = count != 0 ? count : std::max(1u, std::thread::hardware_concurrency());
+}
+
+// Запись доски в часть файла (без временного файла и кеша колонок)
+void Json_worker::board_write(std::FILE* file, const Board& board, bool pretty) {
+    write_json_stream(file, pretty, [&](auto& writer) { write_board(writer, board); });
+}
+
+// Разбор доски из буфера в памяти
+void Json_worker::stage_load(char* data, std::size_t base_offset, BoardStage& stage) {
+    InsituStringStream stream(data);
+    BoardLoadHandler handler(stage);
+    parse_stage<kParseInsituFlag>(stream, base_offset, stage, handler);
+}
+
 // Получение ID задач из JSON файла
-std::vector<std::string> Json_worker::ids_get() {
-    std::vector<std::string> result;
+std::vector<TaskId> Json_worker::ids_get() {
+    // ID уже прочитаны загрузкой доски из этого файла - повторный разбор не нужен
+    if (ids_loaded) {
+        return ids;
+    }
+    
+    std::vector<TaskId> result;
     
-    // Чтение файла
-    std::ifstream file(save_path);
-    if (!file.is_open()) {
+    // Файл отображается в память и разбирается на месте:
+    // строки DOM указывают прямо в буфер отображения
+    std::unique_ptr<MappedFile> file;
+    try {
+        file = std::make_unique<MappedFile>(save_path);
+    } catch (const std::runtime_error&) {
         std::cout << "Cannot open file: " << save_path << std::endl;
         return result;
     }
-    
-    // Загрузка всего содержимого файла в строковый буфер
-    std::stringstream buffer;
-    buffer << file.rdbuf();
-    file.close();
-    
-    // Парсинг JSON из буфера
     Document temp_doc;
-    temp_doc.Parse(buffer.str().c_str());
+    temp_doc.ParseInsitu(file->data());
     
     // Проверка ошибок парсинга
     if (temp_doc.HasParseError()) {
@@ -158,8 +998,8 @@ std::vector<std::string> Json_worker::ids_get() {
             // Проходим по всем элементам массива ID
             for (SizeType i = 0; i < ids_array.Size(); i++) {
                 if (ids_array[i].IsString()) {
-                    // Добавляем ID в результат
-                    result.push_back(ids_array[i].GetString());
+                    // Добавляем ID в результат в упакованном виде
+                    result.push_back(TaskId::from_string(ids_array[i].GetString()));
                 }
             }
             std::cout << "Loaded " << result.size() << " IDs from board: " << board_name << std::endl;
@@ -170,138 +1010,27 @@ std::vector<std::string> Json_worker::ids_get() {
 }
 
 // Загрузка доски из JSON файла
+// BoardLoadHandler создает разработчиков, колонки и задачи по мере разбора - без DOM
 void Json_worker::board_load(Board& board) {
-    // Открываем файл для чтения
-    std::ifstream file(save_path);
-    if (!file.is_open()) {
-        throw std::runtime_error("Cannot open file: " + save_path);
+    // Доска собирается отдельно и применяется только после успешного разбора,
+    // поэтому ошибка в файле не портит текущую доску
+    // Если у доски включена арена, новые объекты берутся из новой арены
+    BoardStage stage;
+    if (board.get_arena()) {
+        stage.arena = std::make_unique<BoardArena>();
     }
-    
-    // Загружаем все содержимое файла в строковый буфер
-    std::stringstream buffer;
-    buffer << file.rdbuf();
-    file.close();
-    
-    // Парсим JSON из буфера
-    Document temp_doc;
-    temp_doc.Parse(buffer.str().c_str());
-    
-    // Проверяем ошибки парсинга
-    if (temp_doc.HasParseError()) {
-        throw std::runtime_error("Invalid JSON format in file: " + save_path);
-    }
-    
-    // Проверяем что в JSON есть хотя бы одна доска
-    if (temp_doc.MemberBegin() == temp_doc.MemberEnd()) {
-        throw std::runtime_error("No boards found in JSON file");
-    }
-    
-    // Извлекаем данные первой (и предположительно единственной) доски из JSON
-    const std::string board_name = temp_doc.MemberBegin()->name.GetString();
-    const Value& board_obj = temp_doc[board_name.c_str()];
-    
-    // Очистка существующих данных доски перед загрузкой новых
-    // Это важно чтобы не смешивать старое и новое состояние
-    board.clear_columns();
-    board.clear_developers();
-    Task::clear_used_ids();  // Очищаем статические ID задач
-    ids.clear();  // Очищаем локальный кэш ID
-    
-    // Загрузка разработчиков из JSON массива
-    if (board_obj.HasMember("developers") && board_obj["developers"].IsArray()) {
-        const Value& developers_array = board_obj["developers"];
-        // Проходим по всем элементам массива разработчиков
-        for (SizeType i = 0; i < developers_array.Size(); i++) {
-            if (developers_array[i].IsString()) {
-                std::string dev_name = developers_array[i].GetString();
-                // Создаем нового разработчика и добавляем на доску
-                auto developer = std::make_unique<Developer>(dev_name);
-                board.add_developer(std::move(developer));
-            }
-        }
-    }
-    
-    // Загрузка ID задач для отслеживания уникальности
-    if (board_obj.HasMember("ids") && board_obj["ids"].IsArray()) {
-        const Value& ids_array = board_obj["ids"];
-        for (SizeType i = 0; i < ids_array.Size(); i++) {
-            if (ids_array[i].IsString()) {
-                std::string id = ids_array[i].GetString();
-                // Добавляем ID в локальный кэш, если его там еще нет
-                if (std::find(ids.begin(), ids.end(), id) == ids.end()) {
-                    ids.push_back(id);
-                }
-            }
-        }
+    if (threads > 1 && load_mode == LoadMode::Mapped) {
+        load_stage_parallel(save_path, threads, stage);
+    } else {
+        load_stage(save_path, load_mode, stage);
     }
     
-    // Загрузка колонок и задач
-    // Проходим по всем полям объекта доски (кроме служебных)
-    for (Value::ConstMemberIterator itr = board_obj.MemberBegin(); 
-         itr != board_obj.MemberEnd(); ++itr) {
-        
-        std::string field_name = itr->name.GetString();
-        // Пропускаем служебные поля "developers" и "ids"
-        if (field_name == "developers" || field_name == "ids") {
-            continue;
-        }
-        
-        // Создание колонки с именем из JSON поля
-        std::string column_name = itr->name.GetString();
-        auto column = std::make_unique<Column>(column_name);
-        
-        // Если значение поля - объект (содержит задачи)
-        if (itr->value.IsObject()) {
-            const Value& tasks_obj = itr->value;
-            
-            // Загрузка задач в колонку
-            // Проходим по всем полям объекта задач (каждое поле - задача)
-            for (Value::ConstMemberIterator task_itr = tasks_obj.MemberBegin();
-                 task_itr != tasks_obj.MemberEnd(); ++task_itr) {
-                
-                // Имя поля - это заголовок задачи
-                std::string task_title = task_itr->name.GetString();
-                const Value& task_data = task_itr->value;
-                
-                // Создаем задачу с полученным заголовком
-                auto task = std::make_unique<Task>(task_title);
-                
-                // Загрузка полей задачи из JSON
-                if (task_data.HasMember("description") && task_data["description"].IsString()) {
-                    task->set_description(task_data["description"].GetString());
-                }
-                
-                if (task_data.HasMember("priority") && task_data["priority"].IsInt()) {
-                    task->set_priority(task_data["priority"].GetInt());
-                }
-                
-                if (task_data.HasMember("id") && task_data["id"].IsString()) {
-                    // Восстанавливаем оригинальный ID задачи
-                    task->set_id(task_data["id"].GetString());
-                }
-                
-                // Назначение разработчика на задачу
-                if (task_data.HasMember("developer") && task_data["developer"].IsString()) {
-                    std::string dev_name = task_data["developer"].GetString();
-                    if (dev_name != "Unassigned") {
-                        // Ищем разработчика на доске по имени
-                        Developer* dev = board.find_developer(dev_name);
-                        if (dev) {
-                            // Назначаем найденного разработчика на задачу
-                            task->set_developer(dev);
-                        }
-                        // Если разработчик не найден, задача остается без назначения
-                    }
-                }
-                
-                // Добавляем задачу в колонку
-                column->add_task(std::move(task));
-            }
-        }
-        
-        // Добавляем колонку на доску
-        board.add_column(std::move(column));
-    }
+    // ID задач не сбрасываются в IdAllocator: у загруженных и старых задач
+    // общие ID учитываются счетчиком, и старые освобождают их при удалении
+    ids = std::move(stage.ids);
+    ids_loaded = true;
+    loaded_board_name = std::move(stage.board_name);
+    stage.apply(board);
     
     std::cout << "Board loaded successfully from file: " << save_path << std::endl;
 }
@@ -309,79 +1038,18 @@ void Json_worker::board_load(Board& board) {
 // Очистка временного хранилища ID
 void Json_worker::clear_ids() {
     ids.clear();
+    ids_loaded = false;
 }
 
 // Проверка валидности файла доски
+// Файл разбирается в отдельную доску, которая затем отбрасывается
 bool Json_worker::is_valid_board_file(const std::string& file_path) const {
-    // Пытаемся открыть файл
-    std::ifstream file(file_path);
-    if (!file.is_open()) {
-        std::cout << "Cannot open file: " << file_path << std::endl;
+    try {
+        BoardStage stage;
+        load_stage(file_path, load_mode, stage);
+    } catch (const std::exception& e) {
+        std::cout << "Invalid board file: " << e.what() << std::endl;
         return false;
     }
-    
-    // Читаем содержимое файла в буфер
-    std::stringstream buffer;
-    buffer << file.rdbuf();
-    file.close();
-    
-    // Парсим JSON для проверки структуры
-    Document temp_doc;
-    temp_doc.Parse(buffer.str().c_str());
-    
-    // Проверяем ошибки парсинга
-    if (temp_doc.HasParseError()) {
-        std::cout << "Invalid JSON format" << std::endl;
-        return false;
-    }
-    
-    // Проверяем что корневой элемент - объект
-    if (!temp_doc.IsObject()) {
-        std::cout << "Root element is not an object" << std::endl;
-        return false;
-    }
-    
-    // Проверяем что в JSON есть хотя бы одна доска
-    if (temp_doc.MemberBegin() == temp_doc.MemberEnd()) {
-        std::cout << "No board found in file" << std::endl;
-        return false;
-    }
-    
-    // Получаем первую доску из файла
-    const std::string board_name = temp_doc.MemberBegin()->name.GetString();
-    const Value& board_obj = temp_doc[board_name.c_str()];
-    
-    // Проверяем что данные доски - объект
-    if (!board_obj.IsObject()) {
-        std::cout << "Board data is not an object" << std::endl;
-        return false;
-    }
-    
-    // Проверяем наличие валидной структуры доски
-    // Доска должна содержать либо стандартные поля, либо колонки с задачами
-    bool has_valid_structure = false;
-    
-    // Проходим по всем полям объекта доски
-    for (Value::ConstMemberIterator itr = board_obj.MemberBegin(); 
-         itr != board_obj.MemberEnd(); ++itr) {
-        std::string field_name = itr->name.GetString();
-        
-        // Проверяем наличие стандартных полей или колонок с задачами
-        if (field_name == "developers" || field_name == "ids") {
-            has_valid_structure = true;
-            break;
-        }
-        
-        // Если поле является объектом (предположительно колонка с задачами)
-        if (itr->value.IsObject()) {
-            const Value& tasks_obj = itr->value;
-            // Проверяем что в колонке есть хотя бы одна задача
-            if (tasks_obj.MemberBegin() != tasks_obj.MemberEnd()) {
-                has_valid_structure = true;
-                break;
-            }
-        }
-    }
-    
-    return has_valid_structure;
-}
\ No newline at end of file
+    return true;
+}
@@ -1,14 +1,112 @@
 #include <ftxui.h>
+#include <chrono>
+#include <cstring>
 #include <iostream>
+#include <memory>
+#include <string>
+#include "board.h"
+#include "board_diff.h"
+#include "json_worker.h"
 
-int main() {
+namespace {
+
+// Загрузка доски из JSON для команд diff и merge
+// Сообщения Json_worker о загрузке не смешиваются с выводом команды
+std::unique_ptr<Board> load_board(const std::string& path) {
+    auto board = std::make_unique<Board>(path);
+    Json_worker reader(path);
+    std::streambuf* output = std::cout.rdbuf(nullptr);
+    try {
+        reader.board_load(*board);
+    } catch (...) {
+        std::cout.rdbuf(output);
+        throw;
+    }
+    std::cout.rdbuf(output);
+    board->set_name(reader.get_loaded_board_name());
+    return board;
+}
+
+// diff <before.json> <after.json> - изменения задач по одной в строке
+int run_diff(const std::string& before_path, const std::string& after_path) {
+    auto before = load_board(before_path);
+    auto after = load_board(after_path);
+    for (const TaskChange& change : diff_boards(*before, *after)) {
+        std::cout << describe_change(change) << '\n';
+    }
+    return 0;
+}
+
+// merge <base.json> <ours.json> <theirs.json> [-o <output.json>]
+// Результат пишется в ours (или в output); при конфликтах и неприменимых изменениях
+// в нем остаются значения ours и код возврата - 1
+int run_merge(const std::string& base_path, const std::string& ours_path, const std::string& theirs_path,
+              const std::string& output_path) {
+    auto base = load_board(base_path);
+    auto ours = load_board(ours_path);
+    auto theirs = load_board(theirs_path);
+    MergeResult result = merge_boards(*base, *ours, *theirs);
+    for (const MergeConflict& conflict : result.conflicts) {
+        std::cout << describe_conflict(conflict) << '\n';
+    }
+    Json_worker writer(output_path);
+    std::streambuf* output = std::cout.rdbuf(nullptr);
     try {
+        writer.board_save(*ours);
+    } catch (...) {
+        std::cout.rdbuf(output);
+        throw;
+    }
+    std::cout.rdbuf(output);
+    std::cout << result.applied << " changes merged, " << result.conflicts.size() << " conflicts" << std::endl;
+    return result.conflicts.empty() ? 0 : 1;
+}
+
+void print_usage(const char* program) {
+    std::cerr << "Usage: " << program << " [--autosave[=milliseconds]]\n"
+              << "       " << program << " diff <before.json> <after.json>\n"
+              << "       " << program << " merge <base.json> <ours.json> <theirs.json> [-o <output.json>]"
+              << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    try {
+        // Команды сравнения и слияния работают без интерфейса
+        if (argc >= 2 && std::strcmp(argv[1], "diff") == 0) {
+            if (argc != 4) {
+                print_usage(argv[0]);
+                return 1;
+            }
+            return run_diff(argv[2], argv[3]);
+        }
+        if (argc >= 2 && std::strcmp(argv[1], "merge") == 0) {
+            if (argc != 5 && !(argc == 7 && std::strcmp(argv[5], "-o") == 0)) {
+                print_usage(argv[0]);
+                return 1;
+            }
+            return run_merge(argv[2], argv[3], argv[4], argc == 7 ? argv[6] : argv[3]);
+        }
+
         ScrumBoardUI app;
+        // --autosave[=мс] - фоновое автосохранение вместо журнала изменений
+        for (int i = 1; i < argc; ++i) {
+            if (std::strcmp(argv[i], "--autosave") == 0) {
+                app.enable_autosave(AutosaveService::default_debounce);
+            } else if (std::strncmp(argv[i], "--autosave=", 11) == 0) {
+                app.enable_autosave(std::chrono::milliseconds(std::stoul(argv[i] + 11)));
+            } else {
+                std::cerr << "Unknown option: " << argv[i] << std::endl;
+                print_usage(argv[0]);
+                return 1;
+            }
+        }
         app.run();
     } catch (const std::exception& e) {
         std::cerr << "Error: " << e.what() << std::endl;
         return 1;
     }
-    
+
     return 0;
 }
@@ -0,0 +1,85 @@
+#include "mapped_file.h"
+#include <cstdio>
+#include <memory>
+#include <stdexcept>
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Открытие и отображение файла
+MappedFile::MappedFile(const std::string& path) {
+#if !defined(_WIN32)
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("Cannot open file: " + path);
+    }
+    struct stat info {};
+    if (::fstat(fd, &info) != 0 || info.st_size <= 0) {
+        ::close(fd);
+        read_fallback(path);
+        return;
+    }
+    size_ = static_cast<std::size_t>(info.st_size);
+
+    // Сначала резервируется анонимная область на байт больше файла (с округлением до страниц),
+    // затем поверх ее начала отображается файл. Хвост области остается нулевой
+    // анонимной памятью, поэтому '\0' после данных есть даже при размере, кратном странице
+    long page = ::sysconf(_SC_PAGESIZE);
+    std::size_t page_size = page > 0 ? static_cast<std::size_t>(page) : 4096;
+    std::size_t total = (size_ + 1 + page_size - 1) / page_size * page_size;
+    void* region = ::mmap(nullptr, total, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (region != MAP_FAILED) {
+        void* file_map = ::mmap(region, size_, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fd, 0);
+        if (file_map != MAP_FAILED) {
+            ::close(fd);
+            data_ = static_cast<char*>(file_map);
+            mapped_size_ = total;
+            return;
+        }
+        ::munmap(region, total);
+    }
+    ::close(fd);
+    size_ = 0;
+#endif
+    read_fallback(path);
+}
+
+MappedFile::~MappedFile() {
+#if !defined(_WIN32)
+    if (mapped_size_ != 0) {
+        ::munmap(data_, mapped_size_);
+    }
+#endif
+}
+
+// Возврат страниц отображения системе (MADV_DONTNEED)
+// Неизмененные страницы частного отображения при следующем чтении берутся из файла заново
+void MappedFile::release_pages() const {
+#if !defined(_WIN32)
+    if (mapped_size_ != 0) {
+        ::madvise(data_, size_, MADV_DONTNEED);
+    }
+#endif
+}
+
+// Чтение файла в буфер целиком (один системный вызов на блок, без промежуточных строк)
+void MappedFile::read_fallback(const std::string& path) {
+    std::unique_ptr<std::FILE, int (*)(std::FILE*)> file(std::fopen(path.c_str(), "rb"), &std::fclose);
+    if (!file) {
+        throw std::runtime_error("Cannot open file: " + path);
+    }
+    char chunk[64 * 1024];
+    std::size_t read;
+    while ((read = std::fread(chunk, 1, sizeof(chunk), file.get())) > 0) {
+        fallback.insert(fallback.end(), chunk, chunk + read);
+    }
+    if (std::ferror(file.get())) {
+        throw std::runtime_error("Cannot read file: " + path);
+    }
+    size_ = fallback.size();
+    fallback.push_back('\0');
+    data_ = fallback.data();
+}
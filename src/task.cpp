@@ -1,111 +1,151 @@
 #include "task.h"
+#include "id_allocator.h"
+#include "board.h"
+#include "column.h"
+#include "mapped_file.h"
 #include <string>
-#include <random>
-#include <algorithm>
+#include <utility>
 #include <stdexcept>
 
-// used_ids будет общим для всех экземпляров Task
-std::vector<std::string> Task::used_ids = {};
-
-// Генерация случайной строки заданной длины
-// Используется для создания уникальных идентификаторов задач
-std::string Task::generate_random_string(int length) {
-    // Набор символов для генерации ID
-    // Используем цифры и буквы в обоих регистрах для большего разнообразия
-    // Исключаем похожие символы типа 0/O, 1/I для избежания путаницы
-    const std::string charset = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz";
-    
-    // Инициализация генератора случайных чисел
-    // std::random_device - источник энтропии (аппаратный генератор если доступен)
-    std::random_device rd;
-    // std::mt19937 - вихрь Мерсенна, качественный псевдослучайный генератор
-    std::mt19937 generator(rd());
-    // Равномерное распределение для индексов в charset
-    // От 0 до размера charset - 1
-    std::uniform_int_distribution<int> distribution(0, charset.size() - 1);
-    
-    // Генерация строки заданной длины
-    std::string result;
-    for (int i = 0; i < length; ++i) {
-        // Добавление случайного символа из charset
-        // distribution(generator) генерирует случайный индекс
-        result += charset[distribution(generator)];
-    }
-    return result;
-}
-
 // Генерация уникального ID для задачи
-std::string Task::generate_id() {
-    std::string new_id;
-    bool unique_found = false;
-    // Максимальное количество попыток генерации
-    // Защита от бесконечного цикла если что-то пошло не так
-    const int max_attempts = 100;
-    int attempts = 0;
-    
-    // Попытка найти уникальный ID
-    // Продолжаем пока не найдем уникальный или не превысим максимальное число попыток
-    while (!unique_found && attempts < max_attempts) {
-        // Генерация ID длиной 6 символов
-        // 6 символов - компромисс между уникальностью и читаемостью
-        new_id = generate_random_string(6);
-        
-        // Проверка уникальности ID в глобальном списке использованных
-        // std::find ищет new_id в векторе used_ids
-        if (std::find(used_ids.begin(), used_ids.end(), new_id) == used_ids.end()) {
-            // Если ID уникален, добавляем в список использованных
-            used_ids.push_back(new_id);
-            unique_found = true;  // Уникальный ID найден, выходим из цикла
-        }
-        attempts++;  // Увеличиваем счетчик попыток
-    }
-    
-    // Если не удалось сгенерировать уникальный ID за максимальное число попыток
-    if (!unique_found) {
-        throw std::runtime_error("Failed to generate unique task ID");
-    }
-    
-    return new_id;
+// Реестр занятых ID хранится в IdAllocator (хеш-таблица, O(1) на операцию)
+TaskId Task::generate_id() {
+    return IdAllocator::instance().allocate();
 }
 
 // Очистка списка использованных ID
 // Полезно при загрузке новой доски или сбросе состояния
 void Task::clear_used_ids() {
-    used_ids.clear();
+    IdAllocator::instance().clear();
 }
 
 // Конструктор задачи
 // Создает задачу с обязательным заголовком и автоматически генерирует ID
-Task::Task(std::string titl) : 
-    title(titl),                    // Инициализация заголовка
+Task::Task(std::string_view titl) : 
+    title(titl, ArenaScope::resource()),  // Инициализация заголовка (в арене, если она активна)
     id(generate_id()),              // Автоматическая генерация уникального ID
-    description(""),                // Пустое описание по умолчанию
+    description(ArenaScope::resource()),  // Пустое описание по умолчанию
     priority(-1),                    // Приоритет 0 по умолчанию
-    developer(nullptr) {}           // Разработчик не назначен по умолчанию
+    developer() {}                  // Разработчик не назначен по умолчанию
+
+// Конструктор восстановления задачи с известным ID
+// ID регистрируется в IdAllocator, чтобы новые задачи его не получили
+Task::Task(std::string_view titl, TaskId restored_id) :
+    title(titl, ArenaScope::resource()),
+    id(restored_id.valid() ? restored_id : generate_id()),
+    description(ArenaScope::resource()),
+    priority(-1),
+    developer() {
+    if (restored_id.valid()) {
+        IdAllocator::instance().reserve(id);
+    }
+}
+
+// Деструктор освобождает ID, чтобы его можно было выдать снова
+Task::~Task() {
+    IdAllocator::instance().release(id);
+}
+
+namespace {
+
+// Индексы колонки и доски держат заголовок и ID задачи, поэтому задачу в колонке
+// нельзя опустошить или подменить перемещением
+const Task& movable(const Task& task) {
+    if (task.get_column()) {
+        throw std::logic_error("Cannot move a task that is in a column");
+    }
+    return task;
+}
+
+} // namespace
+
+// Конструктор перемещения забирает ID у исходной задачи
+// Проверка стоит в инициализаторе первого поля, до того как поля исходной задачи перемещены
+Task::Task(Task&& other) :
+    description((movable(other), std::move(other.description))),
+    id(other.id),
+    title(std::move(other.title)),
+    priority(other.priority),
+    developer(other.developer),
+    lazy_description(other.lazy_description),
+    description_file(std::move(other.description_file)) {
+    other.id = TaskId();
+}
+
+// Присваивание перемещением освобождает собственный ID и забирает чужой
+Task& Task::operator=(Task&& other) {
+    if (this != &other) {
+        movable(*this);
+        movable(other);
+        IdAllocator::instance().release(id);
+        description = std::move(other.description);
+        id = other.id;
+        title = std::move(other.title);
+        priority = other.priority;
+        developer = other.developer;
+        lazy_description = other.lazy_description;
+        description_file = std::move(other.description_file);
+        other.id = TaskId();
+    }
+    return *this;
+}
 
 // Установка описания задачи
-void Task::set_description(std::string descript) {
+// Новое описание хранится в задаче; ленивое описание (и файл под ним) отпускается
+// после копирования, поэтому descript может указывать на текущее описание
+void Task::set_description(std::string_view descript) {
     description = descript;
+    lazy_description = std::string_view();
+    description_file.reset();
+    if (column) {
+        column->on_task_changed(this, TaskField::Description);
+    }
+}
+
+// Установка описания, которое остается в файле
+void Task::set_lazy_description(std::string_view text, std::shared_ptr<const MappedFile> file) {
+    description.clear();
+    description.shrink_to_fit();
+    lazy_description = text;
+    description_file = std::move(file);
+    if (column) {
+        column->on_task_changed(this, TaskField::Description);
+    }
 }
 
 // Получение описания задачи
-std::string Task::get_description() const {
-    return description;
+std::string_view Task::get_description() const {
+    return description_file ? lazy_description : std::string_view(description);
 }
 
-// Получение ID задачи
+// Получение ID задачи в текстовом виде
+// Строка base62 строится только здесь, на границе с JSON и UI
 std::string Task::get_id() const {
+    return id.to_string();
+}
+
+// Получение упакованного ID задачи
+TaskId Task::get_task_id() const {
     return id;
 }
 
 // Получение заголовка задачи
-std::string Task::get_title() const {
+std::string_view Task::get_title() const {
     return title;
 }
 
 // Установка заголовка задачи
-void Task::set_title(std::string titl) {
+// Индекс заголовков колонки хранит представления строки title,
+// поэтому задача убирается из индекса до изменения и возвращается после
+void Task::set_title(std::string_view titl) {
+    if (column) {
+        column->unindex_title(this);
+    }
     title = titl;
+    if (column) {
+        column->index_title(this);
+        column->on_task_changed(this, TaskField::Title);
+    }
 }
 
 // Получение приоритета задачи
@@ -120,23 +160,67 @@ void Task::set_priority(int p) {
         throw std::invalid_argument("Priority must be between 0 and 10");
     }
     priority = p;
+    if (column) {
+        column->on_task_changed(this, TaskField::Priority);
+    }
 }
 
 // Назначение разработчика на задачу
+// Задача хранит только handle разработчика
+// Доска ведет обратный индекс разработчик -> задачи, поэтому сообщаем ей о смене
 void Task::set_developer(Developer* develop) {
-    developer = develop;
+    DeveloperHandle old_developer = developer;
+    developer = develop ? develop->get_handle() : DeveloperHandle();
+    if (column && old_developer != developer) {
+        column->on_task_developer_changed(this, old_developer);
+    }
 }
 
 // Получение разработчика, назначенного на задачу
+// Если разработчик удален, handle устарел и возвращается nullptr
 Developer* Task::get_developer() const {
+    return DeveloperRegistry::instance().get(developer);
+}
+
+// Получение handle разработчика
+DeveloperHandle Task::get_developer_handle() const {
     return developer;
 }
 
+// Получение колонки, в которой находится задача
+Column* Task::get_column() const {
+    return column;
+}
+
 // Установка ID задачи вручную (с валидацией)
 void Task::set_id(std::string new_id) {
     // Проверяем что ID не пустой
     if (new_id.empty()) {
         throw std::invalid_argument("Task ID cannot be empty");
     }
+    set_id(TaskId::from_string(new_id));
+}
+
+// Установка упакованного ID задачи
+void Task::set_id(TaskId new_id) {
+    if (!new_id.valid()) {
+        throw std::invalid_argument("Task ID cannot be empty");
+    }
+    // ID на доске уникален: занятый другой задачей ID не устанавливается
+    if (column && column->get_board()) {
+        Task* owner = column->get_board()->find_task(new_id);
+        if (owner && owner != this) {
+            throw std::invalid_argument("Task ID already exists: " + new_id.to_string());
+        }
+    }
+    // Сначала регистрируем новый ID, затем освобождаем старый,
+    // чтобы повторная установка того же ID не потеряла его в реестре
+    IdAllocator::instance().reserve(new_id);
+    IdAllocator::instance().release(id);
+    TaskId old_id = id;
     id = new_id;
-}
\ No newline at end of file
+    // Индекс ID доски хранит задачу под старым ID - обновляем его
+    if (column) {
+        column->on_task_id_changed(this, old_id);
+    }
+}
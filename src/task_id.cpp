@@ -0,0 +1,105 @@
+#include "task_id.h"
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+const char charset[] = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz";
+constexpr uint64_t base = 62;
+constexpr int length_shift = 60;
+constexpr uint64_t number_mask = (uint64_t(1) << length_shift) - 1;
+constexpr uint64_t foreign_tag = 0xF;
+
+// Значение символа base62 или -1 если символ не входит в набор
+int digit_value(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'A' && c <= 'Z') return c - 'A' + 10;
+    if (c >= 'a' && c <= 'z') return c - 'a' + 36;
+    return -1;
+}
+
+// Таблица ID, которые нельзя упаковать в число (например, заданные вручную)
+// Такие ID редки, поэтому таблица только растет
+struct ForeignIds {
+    std::mutex mutex;
+    std::vector<std::string> strings;
+    std::unordered_map<std::string, uint64_t> indexes;
+};
+
+ForeignIds& foreign_ids() {
+    static ForeignIds table;
+    return table;
+}
+
+} // namespace
+
+// Упаковка числа base62
+TaskId TaskId::from_base62(uint64_t number, std::size_t length) {
+    if (length == 0 || length > max_packed_length) {
+        throw std::invalid_argument("Packed task ID length must be between 1 and 10");
+    }
+    return TaskId((static_cast<uint64_t>(length) << length_shift) | (number & number_mask));
+}
+
+// Преобразование текста в упакованный ID
+TaskId TaskId::from_string(std::string_view text) {
+    if (text.empty()) {
+        return TaskId();
+    }
+
+    // Быстрый путь: строка base62 до 10 символов кодируется числом
+    if (text.size() <= max_packed_length) {
+        uint64_t number = 0;
+        bool packable = true;
+        for (char c : text) {
+            int digit = digit_value(c);
+            if (digit < 0) {
+                packable = false;
+                break;
+            }
+            number = number * base + static_cast<uint64_t>(digit);
+        }
+        if (packable) {
+            return from_base62(number, text.size());
+        }
+    }
+
+    // Медленный путь: строка сохраняется во внутренней таблице
+    auto& table = foreign_ids();
+    std::lock_guard<std::mutex> lock(table.mutex);
+    auto it = table.indexes.find(std::string(text));
+    if (it != table.indexes.end()) {
+        return TaskId((foreign_tag << length_shift) | it->second);
+    }
+    uint64_t index = table.strings.size();
+    table.strings.emplace_back(text);
+    table.indexes.emplace(table.strings.back(), index);
+    return TaskId((foreign_tag << length_shift) | index);
+}
+
+// Текстовое представление ID
+std::string TaskId::to_string() const {
+    if (value == 0) {
+        return std::string();
+    }
+
+    uint64_t tag = value >> length_shift;
+    uint64_t number = value & number_mask;
+
+    if (tag == foreign_tag) {
+        auto& table = foreign_ids();
+        std::lock_guard<std::mutex> lock(table.mutex);
+        return number < table.strings.size() ? table.strings[number] : std::string();
+    }
+
+    // Цифры записываются с конца, старшие разряды дополняются символом '0'
+    std::string result(static_cast<std::size_t>(tag), '0');
+    for (std::size_t i = result.size(); i-- > 0;) {
+        result[i] = charset[number % base];
+        number /= base;
+    }
+    return result;
+}
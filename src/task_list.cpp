@@ -0,0 +1,84 @@
+#include "task_list.h"
+#include "task.h"
+#include <stdexcept>
+
+// Добавление задачи в конец списка
+uint32_t TaskList::push_back(std::unique_ptr<Task> task) {
+    // Сначала используем освободившиеся слоты, чтобы вектор не рос без необходимости
+    uint32_t slot;
+    if (!free_slots.empty()) {
+        slot = free_slots.back();
+        free_slots.pop_back();
+    } else {
+        if (slots.size() >= npos) {
+            throw std::length_error("Too many tasks in column");
+        }
+        slot = static_cast<uint32_t>(slots.size());
+        slots.emplace_back();
+    }
+
+    // Привязываем слот к хвосту списка
+    Slot& entry = slots[slot];
+    entry.task = std::move(task);
+    entry.prev = tail;
+    entry.next = npos;
+    if (tail != npos) {
+        slots[tail].next = slot;
+    } else {
+        head = slot;
+    }
+    tail = slot;
+    ++count;
+    return slot;
+}
+
+// Извлечение задачи из слота
+std::unique_ptr<Task> TaskList::remove(uint32_t slot) {
+    if (slot >= slots.size() || !slots[slot].task) {
+        throw std::out_of_range("Task slot is empty");
+    }
+
+    // Отвязываем слот от соседей в списке
+    Slot& entry = slots[slot];
+    if (entry.prev != npos) {
+        slots[entry.prev].next = entry.next;
+    } else {
+        head = entry.next;
+    }
+    if (entry.next != npos) {
+        slots[entry.next].prev = entry.prev;
+    } else {
+        tail = entry.prev;
+    }
+
+    auto task = std::move(entry.task);
+    entry.prev = entry.next = npos;
+    free_slots.push_back(slot);
+    --count;
+    return task;
+}
+
+// Задача в слоте
+Task* TaskList::at_slot(uint32_t slot) const {
+    return slot < slots.size() ? slots[slot].task.get() : nullptr;
+}
+
+// Удаление всех задач
+void TaskList::clear() {
+    slots.clear();
+    free_slots.clear();
+    head = tail = npos;
+    count = 0;
+}
+
+// Задача на позиции в порядке обхода - обход от начала списка
+const std::unique_ptr<Task>& TaskList::nth(std::size_t index) const {
+    if (index >= count) {
+        throw std::out_of_range("Task index out of range");
+    }
+    uint32_t slot = head;
+    for (std::size_t i = 0; i < index; ++i) {
+        slot = slots[slot].next;
+    }
+    return slots[slot].task;
+}
@@ -0,0 +1,68 @@
+#include "written_files.h"
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <system_error>
+#if !defined(_WIN32)
+#include <sys/stat.h>
+#endif
+
+// Отпечаток файла
+FileStamp FileStamp::of(const std::string& path) {
+    FileStamp stamp;
+#if !defined(_WIN32)
+    struct stat info;
+    if (::stat(path.c_str(), &info) != 0) {
+        return stamp;
+    }
+    stamp.device = static_cast<std::uint64_t>(info.st_dev);
+    stamp.inode = static_cast<std::uint64_t>(info.st_ino);
+    stamp.size = static_cast<std::uint64_t>(info.st_size);
+#if defined(__APPLE__)
+    stamp.modified = static_cast<std::int64_t>(info.st_mtimespec.tv_sec) * 1000000000 + info.st_mtimespec.tv_nsec;
+#else
+    stamp.modified = static_cast<std::int64_t>(info.st_mtim.tv_sec) * 1000000000 + info.st_mtim.tv_nsec;
+#endif
+#else
+    // Без inode версия определяется размером и временем изменения
+    std::error_code error;
+    auto size = std::filesystem::file_size(path, error);
+    auto time = std::filesystem::last_write_time(path, error);
+    if (error) {
+        return stamp;
+    }
+    stamp.size = size;
+    stamp.modified = std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count();
+#endif
+    stamp.exists = true;
+    return stamp;
+}
+
+WrittenFiles& WrittenFiles::instance() {
+    static WrittenFiles files;
+    return files;
+}
+
+// Отметка записанного файла
+void WrittenFiles::record(const std::string& path) {
+    FileStamp stamp = FileStamp::of(path);
+    if (!stamp.exists) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    if (stamps.size() < capacity) {
+        stamps.push_back(stamp);
+    } else {
+        stamps[next] = stamp;
+    }
+    next = (next + 1) % capacity;
+}
+
+// Проверка версии файла
+bool WrittenFiles::contains(const FileStamp& stamp) const {
+    if (!stamp.exists) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    return std::find(stamps.begin(), stamps.end(), stamp) != stamps.end();
+}
@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <string>
+#include <string_view>
+#include "board.h"
+#include "column.h"
+#include "developer.h"
+#include "manager.h"
+#include "task.h"
+
+// Счетчик выделений памяти для проверки путей чтения модели
+// Глобальные operator new/delete заменены на всю тестовую программу,
+// но выделения считаются только внутри AllocationCounter
+namespace {
+
+std::atomic<bool> counting{false};
+std::atomic<std::size_t> allocations{0};
+
+void* counted_allocate(std::size_t size) {
+    if (counting.load(std::memory_order_relaxed)) {
+        allocations.fetch_add(1, std::memory_order_relaxed);
+    }
+    if (void* ptr = std::malloc(size ? size : 1)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+// Область, в которой считаются выделения памяти
+class AllocationCounter {
+public:
+    AllocationCounter() {
+        allocations = 0;
+        counting = true;
+    }
+    ~AllocationCounter() { counting = false; }
+
+    std::size_t count() const { return allocations.load(); }
+};
+
+} // namespace
+
+void* operator new(std::size_t size) { return counted_allocate(size); }
+void* operator new[](std::size_t size) { return counted_allocate(size); }
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { std::free(ptr); }
+
+// Test fixture с заполненной доской
+class AllocationTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        board = std::make_unique<Board>("Allocation Board");
+        const char* names[] = {"Backlog", "Assigned", "In Progress", "Blocked", "Done"};
+        for (const char* name : names) {
+            board->add_column(std::make_unique<Column>(name));
+        }
+        for (int d = 0; d < 10; ++d) {
+            create_developer(*board, "Developer number " + std::to_string(d));
+        }
+
+        // Длинные строки гарантируют, что копия не поместится в SSO-буфер std::string
+        int index = 0;
+        for (const auto& column : board->get_columns()) {
+            for (int t = 0; t < 50; ++t, ++index) {
+                auto task = std::make_unique<Task>("Task with a long enough title #" + std::to_string(index));
+                task->set_description("Description that is definitely longer than the small string buffer");
+                task->set_priority(index % 11);
+                task->set_developer(board->get_developers()[index % 10].get());
+                column->add_task(std::move(task));
+            }
+        }
+    }
+
+    std::unique_ptr<Board> board;
+};
+
+// Поиск колонок, разработчиков и задач не выделяет память
+TEST_F(AllocationTest, LookupsDoNotAllocate) {
+    std::size_t found = 0;
+    std::size_t count;
+    {
+        AllocationCounter counter;
+        found += board->find_column("In Progress") != nullptr;
+        found += board->find_developer("Developer number 7") != nullptr;
+        found += board->find_column("Done")->find_task("Task with a long enough title #240") != nullptr;
+        found += search_task(*board, "Backlog", "Task with a long enough title #10") != nullptr;
+        found += board->find_column("Missing") == nullptr;
+        count = counter.count();
+    }
+    EXPECT_EQ(found, 5);
+    EXPECT_EQ(count, 0);
+}
+
+// Полный обход доски в том же объеме, что и render_board, не выделяет память
+TEST_F(AllocationTest, RenderTraversalDoesNotAllocate) {
+    std::size_t characters = 0;
+    std::size_t count;
+    {
+        AllocationCounter counter;
+        characters += board->get_name().size();
+        for (const auto& column : board->get_columns()) {
+            characters += column->get_name().size();
+            for (const auto& task : column->get_tasks()) {
+                characters += task->get_title().size();
+                std::string_view developer_name = "Unassigned";
+                if (task->get_developer()) {
+                    developer_name = task->get_developer()->get_name();
+                }
+                characters += developer_name.size();
+                characters += static_cast<std::size_t>(task->get_priority());
+                std::string_view desc = task->get_description();
+                characters += desc.length() > 20 ? desc.substr(0, 17).size() : desc.size();
+                // Упакованный ID сравнивается как одно слово
+                characters += task->get_task_id().valid();
+            }
+        }
+        count = counter.count();
+    }
+    EXPECT_GT(characters, 0);
+    EXPECT_EQ(count, 0);
+}
@@ -0,0 +1,137 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <deque>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include "autosave_service.h"
+#include "board.h"
+#include "board_snapshot.h"
+#include "column.h"
+#include "developer.h"
+#include "json_worker.h"
+#include "manager.h"
+#include "task.h"
+#include "test_files.h"
+
+// Test fixture с доской и файлом автосохранения
+class AutosaveServiceTest : public FileTest {
+protected:
+    void SetUp() override {
+        FileTest::SetUp();
+        save_path = path("board.json");
+
+        board = std::make_unique<Board>("Autosave Board");
+        board->add_column(std::make_unique<Column>("Backlog"));
+        board->add_column(std::make_unique<Column>("Done"));
+        create_developer(*board, "Alice");
+        create_task(*board, "Backlog", "Existing");
+    }
+
+    // Ожидаемое содержимое файла - обычное сохранение доски
+    std::string expected() {
+        return dump(*board);
+    }
+
+    // Ожидание условия с ограничением по времени
+    static bool wait_for(const std::function<bool()>& condition) {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        while (!condition()) {
+            if (std::chrono::steady_clock::now() > deadline) {
+                return false;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+        return true;
+    }
+
+    std::string save_path;
+    std::unique_ptr<Board> board;
+};
+
+// Снимок доски сохраняется теми же байтами, что и сама доска
+TEST_F(AutosaveServiceTest, SnapshotMatchesBoardSave) {
+    Task* task = board->find_column("Backlog")->find_task("Existing");
+    task->set_description("Line one\nLine two");
+    task->set_priority(3);
+    task->set_developer(board->find_developer("Alice"));
+    // Разработчик не с этой доски тоже пишется по имени
+    Developer outsider("Outsider");
+    create_task(*board, "Done", "Outside work");
+    board->find_column("Done")->find_task("Outside work")->set_developer(&outsider);
+
+    Json_worker(save_path).snapshot_save(BoardSnapshot::capture(*board));
+    EXPECT_EQ(read_file(save_path), expected());
+    EXPECT_FALSE(std::filesystem::exists(save_path + ".tmp"));
+}
+
+// Серия изменений сливается в одну запись после паузы
+TEST_F(AutosaveServiceTest, BurstIsCoalesced) {
+    AutosaveService autosave(*board, save_path, std::chrono::milliseconds(100));
+    EXPECT_FALSE(autosave.has_unsaved_changes());
+    for (int i = 0; i < 50; ++i) {
+        create_task(*board, "Backlog", "Task " + std::to_string(i));
+    }
+    EXPECT_TRUE(autosave.has_unsaved_changes());
+    ASSERT_TRUE(wait_for([&] { return !autosave.has_unsaved_changes(); }));
+    EXPECT_EQ(autosave.get_save_count(), 1);
+    EXPECT_EQ(read_file(save_path), expected());
+}
+
+// flush пишет изменения сразу, не дожидаясь окна debounce; удаление сервиса - тоже
+TEST_F(AutosaveServiceTest, FlushAndDestructorSave) {
+    {
+        AutosaveService autosave(*board, save_path, std::chrono::hours(1));
+        board->find_column("Backlog")->find_task("Existing")->set_title("Renamed");
+        EXPECT_TRUE(autosave.flush());
+        EXPECT_EQ(autosave.get_save_count(), 1);
+        EXPECT_EQ(read_file(save_path), expected());
+        EXPECT_TRUE(autosave.flush());
+        EXPECT_EQ(autosave.get_save_count(), 1);
+
+        board->move_task(board->find_column("Backlog")->find_task("Renamed")->get_task_id(),
+                         board->find_column("Done"));
+    }
+    EXPECT_EQ(board->get_listener(), nullptr);
+    EXPECT_EQ(read_file(save_path), expected());
+}
+
+// Снимок снимается в потоке доски через executor; задачи после удаления сервиса пусты
+TEST_F(AutosaveServiceTest, CaptureRunsOnBoardThread) {
+    std::mutex queue_mutex;
+    std::deque<std::function<void()>> queue;
+    auto post = [&](std::function<void()> task) {
+        std::lock_guard<std::mutex> lock(queue_mutex);
+        queue.push_back(std::move(task));
+    };
+    auto run_queue = [&] {
+        std::deque<std::function<void()>> tasks;
+        {
+            std::lock_guard<std::mutex> lock(queue_mutex);
+            tasks.swap(queue);
+        }
+        for (auto& task : tasks) {
+            task();
+        }
+        return !tasks.empty();
+    };
+
+    auto autosave = std::make_unique<AutosaveService>(*board, save_path, std::chrono::milliseconds(10), post);
+    create_task(*board, "Done", "Posted");
+    ASSERT_TRUE(wait_for(run_queue));
+    ASSERT_TRUE(wait_for([&] { return !autosave->has_unsaved_changes(); }));
+    EXPECT_EQ(read_file(save_path), expected());
+
+    // Запрос снимка остается в очереди, а сервис удаляется раньше
+    create_task(*board, "Done", "Late");
+    ASSERT_TRUE(wait_for([&] {
+        std::lock_guard<std::mutex> lock(queue_mutex);
+        return !queue.empty();
+    }));
+    autosave.reset();
+    EXPECT_EQ(read_file(save_path), expected());
+    run_queue();
+}
@@ -0,0 +1,131 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include "binary_worker.h"
+#include "board.h"
+#include "board_loader.h"
+#include "column.h"
+#include "developer.h"
+#include "json_worker.h"
+#include "task.h"
+#include "test_files.h"
+
+// Test fixture для двоичного формата доски
+class BinaryWorkerTest : public FileTest {
+protected:
+    void SetUp() override {
+        FileTest::SetUp();
+        // Пустая колонка между колонками с задачами и задача с заданным ID
+        board = make_sample_board("Binary Board", {"Backlog", "Empty", "Done"});
+        board->find_column("Done")->find_task("Task 3")->set_id("custom_id_3");
+    }
+
+    std::unique_ptr<Board> board;
+};
+
+// Сохранение и загрузка восстанавливают доску полностью
+TEST_F(BinaryWorkerTest, SaveLoadRoundTrip) {
+    Binary_worker writer(path("board.tsb"));
+    writer.board_save(*board);
+    EXPECT_TRUE(BinaryBoardView::is_binary_file(path("board.tsb")));
+
+    Board loaded("Loaded");
+    loaded.enable_arena();
+    Binary_worker reader(path("board.tsb"));
+    reader.board_load(loaded);
+    EXPECT_EQ(reader.get_loaded_board_name(), "Binary Board");
+
+    ASSERT_EQ(loaded.get_columns().size(), 3);
+    EXPECT_EQ(loaded.get_columns()[1]->get_name(), "Empty");
+    ASSERT_EQ(loaded.get_developers().size(), 2);
+    Task* task1 = loaded.find_column("Backlog")->find_task("Task \"quoted\"");
+    ASSERT_NE(task1, nullptr);
+    EXPECT_EQ(task1->get_description(), "Line one\nLine two");
+    EXPECT_EQ(task1->get_priority(), 5);
+    EXPECT_EQ(task1->get_developer(), loaded.find_developer("Alice"));
+    EXPECT_EQ(loaded.find_column("Backlog")->find_task("Task 2")->get_priority(), -1);
+    Task* task3 = loaded.find_task(TaskId::from_string("custom_id_3"));
+    ASSERT_NE(task3, nullptr);
+    EXPECT_EQ(task3->get_id(), "custom_id_3");
+    EXPECT_EQ(task3->get_developer(), loaded.find_developer("Bob"));
+    EXPECT_EQ(loaded.get_arena()->get_live_objects(), 8);
+}
+
+// Представление читает строки прямо из отображения файла
+TEST_F(BinaryWorkerTest, ViewReadsWithoutBuildingBoard) {
+    Binary_worker(path("board.tsb")).board_save(*board);
+    BinaryBoardView view(path("board.tsb"));
+    EXPECT_EQ(view.board_name(), "Binary Board");
+    ASSERT_EQ(view.column_count(), 3);
+    EXPECT_EQ(view.column_task_count(0), 2);
+    EXPECT_EQ(view.column_task_count(1), 0);
+    EXPECT_EQ(view.column_first_task(2), 2);
+    ASSERT_EQ(view.task_count(), 3);
+    EXPECT_EQ(view.task_title(0), "Task \"quoted\"");
+    EXPECT_EQ(view.developer_name(view.task_developer(0)), "Alice");
+    EXPECT_EQ(view.task_developer(1), BinaryBoardView::no_developer);
+    EXPECT_EQ(view.task_id(2), TaskId::from_string("custom_id_3"));
+}
+
+// Преобразование JSON -> двоичный -> JSON не теряет данных
+TEST_F(BinaryWorkerTest, JsonConversionIsLossless) {
+    Json_worker(path("board.json")).board_save(*board);
+    Binary_worker::json_to_binary(path("board.json"), path("board.tsb"));
+    Binary_worker::binary_to_json(path("board.tsb"), path("back.json"));
+    EXPECT_EQ(read_file(path("board.json")), read_file(path("back.json")));
+}
+
+// Поврежденные и чужие файлы отклоняются без изменения доски
+TEST_F(BinaryWorkerTest, RejectsDamagedFiles) {
+    Binary_worker(path("board.tsb")).board_save(*board);
+    std::string bytes = read_file(path("board.tsb"));
+
+    // Обрезанный файл
+    std::ofstream(path("short.tsb"), std::ios::binary) << bytes.substr(0, bytes.size() - 4);
+    EXPECT_THROW(Binary_worker(path("short.tsb")).board_load(*board), BoardLoadError);
+
+    // Версия новее поддерживаемой
+    std::string newer = bytes;
+    newer[8] = static_cast<char>(BinaryBoardView::current_version + 1);
+    std::ofstream(path("newer.tsb"), std::ios::binary) << newer;
+    EXPECT_THROW(Binary_worker(path("newer.tsb")).board_load(*board), BoardLoadError);
+
+    // JSON файл не является двоичным снимком
+    Json_worker(path("board.json")).board_save(*board);
+    EXPECT_FALSE(BinaryBoardView::is_binary_file(path("board.json")));
+    EXPECT_THROW(Binary_worker(path("board.json")).board_load(*board), BoardLoadError);
+
+    EXPECT_EQ(board->find_column("Backlog")->get_tasks().size(), 2);
+}
+
+// Ленивые описания читаются из файла, переживают перезапись файла и заменяются изменением
+TEST_F(BinaryWorkerTest, LazyDescriptionsStayInFile) {
+    Binary_worker(path("board.tsb")).board_save(*board);
+
+    Board loaded("Binary Board");
+    Binary_worker reader(path("board.tsb"));
+    reader.set_lazy_descriptions(true);
+    reader.board_load(loaded);
+    Task* task1 = loaded.find_column("Backlog")->find_task("Task \"quoted\"");
+    ASSERT_NE(task1, nullptr);
+    EXPECT_TRUE(task1->has_lazy_description());
+    EXPECT_EQ(task1->get_description(), "Line one\nLine two");
+    EXPECT_FALSE(loaded.find_column("Backlog")->find_task("Task 2")->has_lazy_description());
+
+    // Сохранение в тот же файл заменяет его, а открытое отображение остается действительным
+    Binary_worker(path("board.tsb")).board_save(loaded);
+    EXPECT_EQ(task1->get_description(), "Line one\nLine two");
+    Json_worker(path("eager.json")).board_save(*board);
+    Json_worker(path("lazy.json")).board_save(loaded);
+    EXPECT_EQ(read_file(path("lazy.json")), read_file(path("eager.json")));
+
+    // Изменение описания хранится в задаче и попадает в следующее сохранение
+    task1->set_description("Rewritten");
+    EXPECT_FALSE(task1->has_lazy_description());
+    Binary_worker(path("board.tsb")).board_save(loaded);
+    Board again("Again");
+    Binary_worker(path("board.tsb")).board_load(again);
+    EXPECT_EQ(again.find_column("Backlog")->find_task("Task \"quoted\"")->get_description(), "Rewritten");
+}
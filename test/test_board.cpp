@@ -1,8 +1,13 @@
 #include <gtest/gtest.h>
+#include <cstdint>
 #include <memory>
+#include <stdexcept>
+#include <vector>
 #include "board.h"
+#include "board_loader.h"
 #include "column.h"
 #include "developer.h"
+#include "task.h"
 
 //Тест для тестирования класса Board
 class BoardTest : public ::testing::Test {
@@ -163,4 +168,265 @@ TEST_F(BoardTest, MultipleOperations) {
     // Проверка что данные очищены
     EXPECT_TRUE(board->get_columns().empty());
     EXPECT_TRUE(board->get_developers().empty());
-}
\ No newline at end of file
+}
+// Тест поиска задачи по ID на всей доске
+TEST_F(BoardTest, FindTaskById) {
+    board->add_column(std::make_unique<Column>("Backlog"));
+    board->add_column(std::make_unique<Column>("Done"));
+    
+    auto task = std::make_unique<Task>("Indexed Task");
+    Task* task_ptr = task.get();
+    TaskId id = task->get_task_id();
+    board->find_column("Done")->add_task(std::move(task));
+    
+    // Поиск по ID не требует знать колонку
+    EXPECT_EQ(board->find_task(id), task_ptr);
+    EXPECT_EQ(board->find_task(id)->get_column(), board->find_column("Done"));
+    EXPECT_EQ(board->find_task(TaskId::from_string("zzzzzz")), nullptr);
+    
+    // Смена ID обновляет индекс
+    task_ptr->set_id("Renamed1");
+    EXPECT_EQ(board->find_task(id), nullptr);
+    EXPECT_EQ(board->find_task(TaskId::from_string("Renamed1")), task_ptr);
+}
+
+// Тест индексации задач колонки, заполненной до добавления на доску
+TEST_F(BoardTest, AddColumnIndexesExistingTasks) {
+    auto column = std::make_unique<Column>("Loaded");
+    auto task = std::make_unique<Task>("Loaded Task", TaskId::from_string("L0aded"));
+    Task* task_ptr = task.get();
+    column->add_task(std::move(task));
+    board->add_column(std::move(column));
+    
+    EXPECT_EQ(board->find_task(TaskId::from_string("L0aded")), task_ptr);
+    
+    // После очистки колонок индекс пуст
+    board->clear_columns();
+    EXPECT_EQ(board->find_task(TaskId::from_string("L0aded")), nullptr);
+}
+
+// Тест перемещения и удаления задачи по ID
+TEST_F(BoardTest, MoveAndDeleteTaskById) {
+    board->add_column(std::make_unique<Column>("Backlog"));
+    board->add_column(std::make_unique<Column>("Done"));
+    Column* backlog = board->find_column("Backlog");
+    Column* done = board->find_column("Done");
+    
+    auto task = std::make_unique<Task>("Task");
+    TaskId id = task->get_task_id();
+    backlog->add_task(std::move(task));
+    
+    // Перемещение по ID
+    board->move_task(id, done);
+    EXPECT_TRUE(backlog->get_tasks().empty());
+    EXPECT_EQ(done->get_tasks().size(), 1);
+    EXPECT_EQ(board->find_task(id)->get_column(), done);
+    
+    // Удаление по ID
+    board->delete_task(id);
+    EXPECT_TRUE(done->get_tasks().empty());
+    EXPECT_EQ(board->find_task(id), nullptr);
+    
+    // Операции с несуществующим ID вызывают исключение
+    EXPECT_THROW(board->delete_task(id), std::runtime_error);
+    EXPECT_THROW(board->move_task(id, backlog), std::runtime_error);
+}
+
+// Тест обратного индекса разработчик -> задачи
+TEST_F(BoardTest, DeveloperTasksIndex) {
+    board->add_column(std::make_unique<Column>("Backlog"));
+    board->add_column(std::make_unique<Column>("Done"));
+    board->add_developer(std::make_unique<Developer>("Alice"));
+    board->add_developer(std::make_unique<Developer>("Bob"));
+    Developer* alice = board->find_developer("Alice");
+    Developer* bob = board->find_developer("Bob");
+    Column* backlog = board->find_column("Backlog");
+    Column* done = board->find_column("Done");
+    
+    backlog->add_task(std::make_unique<Task>("Task 1"));
+    backlog->add_task(std::make_unique<Task>("Task 2"));
+    done->add_task(std::make_unique<Task>("Task 3"));
+    Task* task1 = backlog->find_task("Task 1");
+    Task* task2 = backlog->find_task("Task 2");
+    Task* task3 = done->find_task("Task 3");
+    
+    task1->set_developer(alice);
+    task2->set_developer(alice);
+    task3->set_developer(bob);
+    EXPECT_EQ(board->get_developer_tasks(alice).size(), 2);
+    EXPECT_EQ(board->get_developer_tasks(bob).size(), 1);
+    
+    // Перемещение не меняет назначений, удаление задачи убирает ее из индекса
+    move_task(backlog, done, task1);
+    EXPECT_EQ(board->get_developer_tasks(alice).count(task1), 1);
+    backlog->delete_task("Task 2");
+    EXPECT_EQ(board->get_developer_tasks(alice).size(), 1);
+    
+    // Передача задач другому разработчику
+    board->reassign_developer(alice, bob);
+    EXPECT_TRUE(board->get_developer_tasks(alice).empty());
+    EXPECT_EQ(board->get_developer_tasks(bob).size(), 2);
+    EXPECT_EQ(task1->get_developer(), bob);
+    
+    // Удаление разработчика снимает его со всех задач
+    board->delete_developer(bob);
+    EXPECT_EQ(task1->get_developer(), nullptr);
+    EXPECT_EQ(task3->get_developer(), nullptr);
+    EXPECT_EQ(board->find_developer("Bob"), nullptr);
+    EXPECT_EQ(board->get_developers().size(), 1);
+}
+
+// Тест индекса имен колонок и разработчиков
+TEST_F(BoardTest, NameIndexFollowsRename) {
+    board->add_column(std::make_unique<Column>("Backlog"));
+    board->add_developer(std::make_unique<Developer>("Alice"));
+    Column* backlog = board->find_column("Backlog");
+    Developer* alice = board->find_developer("Alice");
+    ASSERT_NE(backlog, nullptr);
+    ASSERT_NE(alice, nullptr);
+    
+    // После переименования объект ищется только по новому имени
+    backlog->set_name("Todo");
+    alice->set_name("Alicia");
+    EXPECT_EQ(board->find_column("Backlog"), nullptr);
+    EXPECT_EQ(board->find_column("Todo"), backlog);
+    EXPECT_EQ(board->find_developer("Alice"), nullptr);
+    EXPECT_EQ(board->find_developer("Alicia"), alice);
+    
+    // После очистки индексы пусты
+    board->clear_columns();
+    board->clear_developers();
+    EXPECT_EQ(board->find_column("Todo"), nullptr);
+    EXPECT_EQ(board->find_developer("Alicia"), nullptr);
+}
+
+// Тест одинаковых имен: находится первый добавленный объект
+TEST_F(BoardTest, NameIndexDuplicateNames) {
+    board->add_developer(std::make_unique<Developer>("Sam"));
+    board->add_developer(std::make_unique<Developer>("Sam"));
+    Developer* first = board->get_developers()[0].get();
+    Developer* second = board->get_developers()[1].get();
+    EXPECT_EQ(board->find_developer("Sam"), first);
+    
+    // При удалении первого индекс переходит ко второму
+    board->delete_developer(first);
+    EXPECT_EQ(board->find_developer("Sam"), second);
+    
+    // То же при переименовании колонки с повторяющимся именем
+    board->add_column(std::make_unique<Column>("Done"));
+    board->add_column(std::make_unique<Column>("Done"));
+    Column* done1 = board->get_columns()[0].get();
+    Column* done2 = board->get_columns()[1].get();
+    EXPECT_EQ(board->find_column("Done"), done1);
+    done1->set_name("Archive");
+    EXPECT_EQ(board->find_column("Done"), done2);
+    EXPECT_EQ(board->find_column("Archive"), done1);
+}
+
+// Тест ревизий: любое изменение доски, колонки или задачи отмечает доску измененной
+TEST_F(BoardTest, RevisionTracksChanges) {
+    board->add_column(std::make_unique<Column>("Backlog"));
+    board->add_column(std::make_unique<Column>("Done"));
+    board->add_developer(std::make_unique<Developer>("Alice"));
+    Column* backlog = board->find_column("Backlog");
+    Column* done = board->find_column("Done");
+    backlog->add_task(std::make_unique<Task>("Task"));
+    Task* task = backlog->find_task("Task");
+    EXPECT_TRUE(board->has_unsaved_changes());
+    
+    board->mark_saved();
+    EXPECT_FALSE(board->has_unsaved_changes());
+    
+    // Изменение поля задачи меняет ревизию ее колонки и доски
+    std::uint64_t backlog_revision = backlog->get_revision();
+    std::uint64_t done_revision = done->get_revision();
+    task->set_priority(3);
+    EXPECT_TRUE(board->has_unsaved_changes());
+    EXPECT_NE(backlog->get_revision(), backlog_revision);
+    EXPECT_EQ(done->get_revision(), done_revision);
+    EXPECT_EQ(board->get_revision(), backlog->get_revision());
+    
+    // Перемещение меняет обе колонки
+    board->mark_saved();
+    backlog_revision = backlog->get_revision();
+    move_task(backlog, done, task);
+    EXPECT_TRUE(board->has_unsaved_changes());
+    EXPECT_NE(backlog->get_revision(), backlog_revision);
+    EXPECT_NE(done->get_revision(), done_revision);
+    
+    // Переименование разработчика меняет колонки с его задачами
+    task->set_developer(board->find_developer("Alice"));
+    board->mark_saved();
+    backlog_revision = backlog->get_revision();
+    done_revision = done->get_revision();
+    board->find_developer("Alice")->set_name("Alicia");
+    EXPECT_TRUE(board->has_unsaved_changes());
+    EXPECT_EQ(backlog->get_revision(), backlog_revision);
+    EXPECT_NE(done->get_revision(), done_revision);
+    
+    // Чтение не меняет ревизию
+    board->mark_saved();
+    board->find_task(task->get_task_id());
+    board->get_developer_tasks(board->find_developer("Alicia"));
+    EXPECT_FALSE(board->has_unsaved_changes());
+}
+
+// Тест уникальности ID: задача с занятым ID не попадает на доску, доска не меняется
+TEST_F(BoardTest, DuplicateIdsAreRejected) {
+    board->add_column(std::make_unique<Column>("Backlog"));
+    board->add_column(std::make_unique<Column>("Done"));
+    Column* backlog = board->find_column("Backlog");
+    Column* done = board->find_column("Done");
+    const TaskId id = TaskId::from_string("abc123");
+    backlog->add_task(std::make_unique<Task>("First", id));
+    Task* first = board->find_task(id);
+
+    EXPECT_THROW(done->add_task(std::make_unique<Task>("Second", id)), std::invalid_argument);
+    EXPECT_TRUE(done->get_tasks().empty());
+
+    // Пакет: повтор с доской и внутри пакета
+    std::vector<std::unique_ptr<Task>> batch;
+    batch.push_back(std::make_unique<Task>("Fresh", TaskId::from_string("fresh1")));
+    batch.push_back(std::make_unique<Task>("Clash", id));
+    EXPECT_THROW(done->add_tasks(std::move(batch)), std::invalid_argument);
+    batch.clear();
+    batch.push_back(std::make_unique<Task>("Twin 1", TaskId::from_string("twin01")));
+    batch.push_back(std::make_unique<Task>("Twin 2", TaskId::from_string("twin01")));
+    EXPECT_THROW(done->add_tasks(std::move(batch)), std::invalid_argument);
+    EXPECT_TRUE(done->get_tasks().empty());
+    EXPECT_EQ(board->find_task(TaskId::from_string("fresh1")), nullptr);
+    EXPECT_EQ(board->find_task(TaskId::from_string("twin01")), nullptr);
+
+    // Смена ID на занятый
+    done->add_task(std::make_unique<Task>("Other"));
+    Task* other = done->find_task("Other");
+    TaskId other_id = other->get_task_id();
+    EXPECT_THROW(other->set_id(id), std::invalid_argument);
+    EXPECT_EQ(other->get_task_id(), other_id);
+    EXPECT_NO_THROW(first->set_id(id));
+
+    // Колонка с занятым ID и перенос задачи с другой доски
+    auto loaded = std::make_unique<Column>("Loaded");
+    loaded->add_task(std::make_unique<Task>("Copy", id));
+    EXPECT_THROW(board->add_column(std::move(loaded)), std::invalid_argument);
+    EXPECT_EQ(board->find_column("Loaded"), nullptr);
+    Board foreign("Foreign");
+    foreign.add_column(std::make_unique<Column>("Inbox"));
+    foreign.find_column("Inbox")->add_task(std::make_unique<Task>("Foreign copy", id));
+    Task* copy = foreign.find_task(id);
+    EXPECT_THROW(move_task(foreign.find_column("Inbox"), backlog, copy), std::invalid_argument);
+    EXPECT_EQ(foreign.find_task(id), copy);
+
+    // Загруженная доска с повтором ID не применяется
+    BoardStage stage;
+    for (const char* name : {"A", "B"}) {
+        auto column = std::make_unique<Column>(name);
+        column->add_task(std::make_unique<Task>(name, TaskId::from_string("same01")));
+        stage.columns.push_back(std::move(column));
+    }
+    EXPECT_THROW(stage.apply(*board), std::invalid_argument);
+    EXPECT_EQ(board->get_columns().size(), 2u);
+    EXPECT_EQ(board->find_task(id), first);
+    EXPECT_EQ(first->get_column(), backlog);
+    EXPECT_EQ(board->find_task(other_id), other);
+}
@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include "board.h"
+#include "board_arena.h"
+#include "board_loader.h"
+#include "column.h"
+#include "developer.h"
+#include "task.h"
+
+// Test fixture с доской в режиме арены
+class BoardArenaTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        board = std::make_unique<Board>("Arena Board");
+        board->enable_arena(4096);
+    }
+
+    // Заполнение доски так же, как это делает загрузка
+    void populate(int task_count) {
+        ArenaScope scope(board->get_arena());
+        board->add_developer(std::make_unique<Developer>("Developer with a long enough name"));
+        auto column = std::make_unique<Column>("Column with a long enough name");
+        for (int i = 0; i < task_count; ++i) {
+            auto task = std::make_unique<Task>("Task with a long enough title #" + std::to_string(i));
+            task->set_description("Description that is definitely longer than the small string buffer");
+            task->set_developer(board->get_developers()[0].get());
+            column->add_task(std::move(task));
+        }
+        board->add_column(std::move(column));
+    }
+
+    std::unique_ptr<Board> board;
+};
+
+// Объекты, созданные в области арены, берут память из нее
+TEST_F(BoardArenaTest, ObjectsComeFromArena) {
+    populate(100);
+    BoardArena* arena = board->get_arena();
+    EXPECT_EQ(arena->get_live_objects(), 102);  // 100 задач, колонка и разработчик
+    EXPECT_GT(arena->get_reserved_bytes(), 0);
+
+    // Данные в арене читаются как обычно
+    Column* column = board->find_column("Column with a long enough name");
+    ASSERT_NE(column, nullptr);
+    Task* task = column->find_task("Task with a long enough title #42");
+    ASSERT_NE(task, nullptr);
+    EXPECT_EQ(task->get_developer()->get_name(), "Developer with a long enough name");
+}
+
+// Объекты вне области арены создаются в куче и освобождаются как обычно
+TEST_F(BoardArenaTest, ObjectsOutsideScopeUseHeap) {
+    board->add_column(std::make_unique<Column>("Heap Column"));
+    board->find_column("Heap Column")->add_task(std::make_unique<Task>("Heap Task"));
+    EXPECT_EQ(board->get_arena()->get_live_objects(), 0);
+
+    board->clear_columns();
+    EXPECT_NO_THROW(board->release_arena());
+}
+
+// Освобождение арены с живыми объектами запрещено
+TEST_F(BoardArenaTest, ReleaseRequiresClearedBoard) {
+    populate(10);
+    EXPECT_THROW(board->release_arena(), std::logic_error);
+
+    board->clear_columns();
+    board->clear_developers();
+    EXPECT_EQ(board->get_arena()->get_live_objects(), 0);
+    board->release_arena();
+    EXPECT_EQ(board->get_arena()->get_block_count(), 0);
+
+    // После освобождения арена снова пригодна для загрузки
+    populate(10);
+    EXPECT_EQ(board->get_arena()->get_live_objects(), 12);
+}
+
+// Перемещение задачи между объектами сохраняет ее строки
+TEST_F(BoardArenaTest, MoveBetweenColumns) {
+    populate(5);
+    Column* source = board->find_column("Column with a long enough name");
+    board->add_column(std::make_unique<Column>("Done"));
+    Column* done = board->find_column("Done");
+
+    Task* task = source->find_task("Task with a long enough title #3");
+    move_task(source, done, task);
+    EXPECT_EQ(done->find_task("Task with a long enough title #3"), task);
+    EXPECT_EQ(task->get_description(), "Description that is definitely longer than the small string buffer");
+}
+
+// Применение загруженной доски, когда объект старой арены живет вне доски
+TEST_F(BoardArenaTest, ApplyKeepsEscapedObjects) {
+    populate(3);
+    Column* column = board->find_column("Column with a long enough name");
+    std::unique_ptr<Task> escaped = column->take_task(column->find_task("Task with a long enough title #1"));
+
+    BoardStage stage;
+    stage.arena = std::make_unique<BoardArena>(4096);
+    {
+        ArenaScope scope(stage.arena.get());
+        auto loaded = std::make_unique<Column>("Loaded");
+        loaded->add_task(std::make_unique<Task>("Loaded task"));
+        stage.columns.push_back(std::move(loaded));
+    }
+    ASSERT_NO_THROW(stage.apply(*board));
+
+    // Доска заменена целиком, перенесенная задача по-прежнему читается
+    ASSERT_EQ(board->get_columns().size(), 1u);
+    EXPECT_NE(board->find_column("Loaded")->find_task("Loaded task"), nullptr);
+    EXPECT_EQ(escaped->get_title(), "Task with a long enough title #1");
+    EXPECT_EQ(escaped->get_description(), "Description that is definitely longer than the small string buffer");
+    EXPECT_EQ(board->get_arena()->get_live_objects(), 3);  // Колонка, задача и перенесенная задача
+
+    escaped.reset();
+    EXPECT_EQ(board->get_arena()->get_live_objects(), 2);
+    board->clear_columns();
+    EXPECT_NO_THROW(board->release_arena());
+    EXPECT_EQ(board->get_arena()->get_block_count(), 0);
+}
@@ -0,0 +1,184 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+#include "board.h"
+#include "board_container.h"
+#include "board_loader.h"
+#include "column.h"
+#include "developer.h"
+#include "json_worker.h"
+#include "task.h"
+#include "test_files.h"
+
+// Test fixture для контейнера досок
+class BoardContainerTest : public FileTest {
+protected:
+    // Доска команды с задачами в двух колонках
+    static std::unique_ptr<Board> make_board(const std::string& name, int task_count) {
+        auto board = std::make_unique<Board>(name);
+        board->add_column(std::make_unique<Column>("Backlog"));
+        board->add_column(std::make_unique<Column>("Done"));
+        board->add_developer(std::make_unique<Developer>(name + " lead"));
+        for (int i = 0; i < task_count; ++i) {
+            auto task = std::make_unique<Task>(name + " task " + std::to_string(i));
+            task->set_description("Description \"" + std::to_string(i) + "\"\n");
+            task->set_priority(i % 11);
+            if (i % 2 == 0) {
+                task->set_developer(board->find_developer(name + " lead"));
+            }
+            board->get_columns()[i % 2]->add_task(std::move(task));
+        }
+        return board;
+    }
+};
+
+// Доски добавляются по одной и открываются по имени
+TEST_F(BoardContainerTest, SaveListLoad) {
+    auto alpha = make_board("Alpha", 5);
+    auto beta = make_board("Beta", 3);
+    {
+        BoardContainer container(path("boards.tsb"));
+        EXPECT_TRUE(container.list().empty());
+        container.board_save(*alpha);
+        container.board_save(*beta, false);
+        EXPECT_EQ(container.list(), (std::vector<std::string>{"Alpha", "Beta"}));
+        // Мертвые байты - только индекс, замененный второй записью
+        EXPECT_EQ(container.get_dead_bytes(), sizeof(ContainerEntry) + std::string("Alpha").size());
+    }
+    EXPECT_TRUE(BoardContainer::is_container_file(path("boards.tsb")));
+
+    // Индекс читается из файла заново
+    BoardContainer container(path("boards.tsb"));
+    EXPECT_EQ(container.list(), (std::vector<std::string>{"Alpha", "Beta"}));
+    EXPECT_TRUE(container.contains("Beta"));
+    EXPECT_FALSE(container.contains("Gamma"));
+
+    Board loaded("Other");
+    container.board_load("Beta", loaded);
+    EXPECT_EQ(loaded.get_name(), "Beta");
+    EXPECT_EQ(dump(loaded), dump(*beta));
+    container.board_load("Alpha", loaded);
+    EXPECT_EQ(dump(loaded), dump(*alpha));
+
+    EXPECT_THROW(container.board_load("Gamma", loaded), std::runtime_error);
+}
+
+// Замена доски не трогает остальные; compact убирает старые сегменты
+TEST_F(BoardContainerTest, ReplaceRemoveAndCompact) {
+    auto alpha = make_board("Alpha", 4);
+    auto beta = make_board("Beta", 4);
+    auto gamma = make_board("Gamma", 4);
+    BoardContainer container(path("boards.tsb"));
+    container.board_save(*alpha);
+    container.board_save(*beta);
+    container.board_save(*gamma);
+    auto beta_offset = container.get_entries()[1].offset;
+    auto size = std::filesystem::file_size(path("boards.tsb"));
+
+    // Новая версия дописывается в конец; сегменты других досок остаются на месте
+    alpha->get_columns()[0]->add_task(std::make_unique<Task>("Late task"));
+    container.board_save(*alpha);
+    EXPECT_EQ(container.list(), (std::vector<std::string>{"Alpha", "Beta", "Gamma"}));
+    EXPECT_EQ(container.get_entries()[1].offset, beta_offset);
+    EXPECT_GE(container.get_entries()[0].offset, size);
+    EXPECT_GT(container.get_dead_bytes(), 0u);
+
+    container.board_remove("Beta");
+    EXPECT_EQ(container.list(), (std::vector<std::string>{"Alpha", "Gamma"}));
+    EXPECT_THROW(container.board_remove("Beta"), std::runtime_error);
+
+    auto dead = container.get_dead_bytes();
+    auto before = std::filesystem::file_size(path("boards.tsb"));
+    container.compact();
+    EXPECT_EQ(container.get_dead_bytes(), 0u);
+    EXPECT_LT(std::filesystem::file_size(path("boards.tsb")), before - dead + 1);
+
+    BoardContainer reopened(path("boards.tsb"));
+    EXPECT_EQ(reopened.list(), (std::vector<std::string>{"Alpha", "Gamma"}));
+    EXPECT_EQ(reopened.get_dead_bytes(), 0u);
+    Board loaded("Loaded");
+    reopened.board_load("Alpha", loaded);
+    EXPECT_NE(loaded.find_column("Backlog")->find_task("Late task"), nullptr);
+    EXPECT_EQ(dump(loaded), dump(*alpha));
+    reopened.board_load("Gamma", loaded);
+    EXPECT_EQ(dump(loaded), dump(*gamma));
+}
+
+// Прерванная запись оставляет хвост в конце файла, но прежний индекс цел
+TEST_F(BoardContainerTest, InterruptedWriteKeepsOldIndex) {
+    auto alpha = make_board("Alpha", 3);
+    {
+        BoardContainer container(path("boards.tsb"));
+        container.board_save(*alpha);
+    }
+    {
+        std::ofstream file(path("boards.tsb"), std::ios::binary | std::ios::app);
+        file << "{\"Beta\": {\"ids\": [";
+    }
+
+    BoardContainer container(path("boards.tsb"));
+    EXPECT_EQ(container.list(), (std::vector<std::string>{"Alpha"}));
+    Board loaded("Loaded");
+    container.board_load("Alpha", loaded);
+    EXPECT_EQ(dump(loaded), dump(*alpha));
+
+    // Следующая запись идет после хвоста, хвост считается мертвыми байтами
+    auto beta = make_board("Beta", 2);
+    container.board_save(*beta);
+    container.board_load("Beta", loaded);
+    EXPECT_EQ(dump(loaded), dump(*beta));
+    EXPECT_GT(container.get_dead_bytes(), 0u);
+}
+
+// Поврежденный заголовок или сегмент - BoardLoadError, доска не меняется
+TEST_F(BoardContainerTest, RejectsDamagedFiles) {
+    {
+        std::ofstream file(path("plain.json"));
+        file << "{\"Board\": {}}";
+    }
+    EXPECT_FALSE(BoardContainer::is_container_file(path("plain.json")));
+    EXPECT_THROW(BoardContainer container(path("plain.json")), BoardLoadError);
+
+    auto alpha = make_board("Alpha", 3);
+    BoardContainer container(path("boards.tsb"));
+    container.board_save(*alpha);
+    std::uint64_t offset = container.get_entries()[0].offset;
+
+    // Индекс за пределами файла
+    std::string bytes = read_file(path("boards.tsb"));
+    std::string damaged = bytes;
+    damaged[offsetof(ContainerHeader, index_offset) + 7] = '\x7f';
+    {
+        std::ofstream file(path("damaged.tsb"), std::ios::binary);
+        file << damaged;
+    }
+    try {
+        BoardContainer broken(path("damaged.tsb"));
+        FAIL() << "Expected BoardLoadError";
+    } catch (const BoardLoadError& e) {
+        EXPECT_EQ(e.get_offset(), offsetof(ContainerHeader, index_offset));
+    }
+
+    // Сломанный JSON в сегменте: смещение ошибки - от начала файла
+    damaged = bytes;
+    damaged[offset + 1] = '!';
+    {
+        std::ofstream file(path("damaged.tsb"), std::ios::binary);
+        file << damaged;
+    }
+    BoardContainer broken(path("damaged.tsb"));
+    Board loaded("Keep");
+    loaded.add_column(std::make_unique<Column>("Untouched"));
+    try {
+        broken.board_load("Alpha", loaded);
+        FAIL() << "Expected BoardLoadError";
+    } catch (const BoardLoadError& e) {
+        EXPECT_EQ(e.get_offset(), offset + 1);
+    }
+    EXPECT_NE(loaded.find_column("Untouched"), nullptr);
+    EXPECT_EQ(loaded.get_name(), "Keep");
+}
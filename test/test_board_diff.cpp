@@ -0,0 +1,189 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+#include "board.h"
+#include "board_diff.h"
+#include "column.h"
+#include "developer.h"
+#include "json_worker.h"
+#include "task.h"
+#include "test_files.h"
+
+// Test fixture для сравнения и слияния досок
+// ours и theirs - копии base через JSON, поэтому ID задач у всех трех совпадают
+class BoardDiffTest : public FileTest {
+protected:
+    void SetUp() override {
+        FileTest::SetUp();
+
+        base = std::make_unique<Board>("Team");
+        base->add_column(std::make_unique<Column>("Backlog"));
+        base->add_column(std::make_unique<Column>("Done"));
+        base->add_developer(std::make_unique<Developer>("Alice"));
+        base->add_developer(std::make_unique<Developer>("Bob"));
+        for (const char* title : {"Alpha", "Beta", "Gamma", "Delta"}) {
+            auto task = std::make_unique<Task>(title);
+            task->set_priority(1);
+            task->set_developer(base->find_developer("Alice"));
+            base->find_column("Backlog")->add_task(std::move(task));
+        }
+        ours = copy(*base);
+        theirs = copy(*base);
+    }
+
+    std::unique_ptr<Board> copy(const Board& source) const {
+        std::string file = path("copy.json");
+        Json_worker(file).board_save(source);
+        auto board = std::make_unique<Board>("Team");
+        Json_worker(file).board_load(*board);
+        return board;
+    }
+
+    static Task* task(Board& board, const char* title) {
+        for (const auto& column : board.get_columns()) {
+            if (Task* found = column->find_task(title)) {
+                return found;
+            }
+        }
+        return nullptr;
+    }
+
+    TaskId id(const char* title) const {
+        return task(*base, title)->get_task_id();
+    }
+
+    std::unique_ptr<Board> base;
+    std::unique_ptr<Board> ours;
+    std::unique_ptr<Board> theirs;
+};
+
+// Перемещение, правка, переназначение, добавление и удаление
+TEST_F(BoardDiffTest, DiffDetectsChanges) {
+    EXPECT_TRUE(diff_boards(*base, *theirs).empty());
+
+    theirs->move_task(id("Alpha"), theirs->find_column("Done"));
+    task(*theirs, "Beta")->set_title("Beta 2");
+    task(*theirs, "Gamma")->set_developer(theirs->find_developer("Bob"));
+    theirs->find_column("Backlog")->add_task(std::make_unique<Task>("Epsilon"));
+    theirs->delete_task(id("Delta"));
+
+    auto changes = diff_boards(*base, *theirs);
+    ASSERT_EQ(changes.size(), 5u);
+    // Порядок обхода after: колонка Backlog, затем Done; удаленные - в конце
+    EXPECT_EQ(changes[0].kind, TaskChange::Kind::Changed);
+    EXPECT_EQ(changes[0].id, id("Beta"));
+    EXPECT_EQ(changes[0].fields, unsigned(DiffTitle));
+    EXPECT_TRUE(changes[0].edited());
+    EXPECT_EQ(changes[1].id, id("Gamma"));
+    EXPECT_TRUE(changes[1].reassigned());
+    EXPECT_FALSE(changes[1].edited());
+    EXPECT_EQ(changes[2].kind, TaskChange::Kind::Added);
+    EXPECT_EQ(changes[2].after->get_title(), "Epsilon");
+    EXPECT_EQ(changes[3].id, id("Alpha"));
+    EXPECT_TRUE(changes[3].moved());
+    EXPECT_EQ(changes[4].kind, TaskChange::Kind::Removed);
+    EXPECT_EQ(changes[4].id, id("Delta"));
+
+    EXPECT_EQ(describe_change(changes[1]),
+              "~ " + id("Gamma").to_string() + " [Backlog] Gamma: developer Alice -> Bob");
+    EXPECT_EQ(describe_change(changes[3]),
+              "~ " + id("Alpha").to_string() + " [Done] Alpha: column Backlog -> Done");
+    EXPECT_EQ(describe_change(changes[4]), "- " + id("Delta").to_string() + " [Backlog] Delta");
+}
+
+// Независимые изменения сторон сливаются без конфликтов
+TEST_F(BoardDiffTest, MergeCombinesIndependentChanges) {
+    task(*ours, "Alpha")->set_title("Alpha (ours)");
+    task(*ours, "Beta")->set_priority(7);
+
+    theirs->move_task(id("Alpha"), theirs->find_column("Done"));
+    task(*theirs, "Beta")->set_description("Details");
+    theirs->add_column(std::make_unique<Column>("Review"));
+    theirs->add_developer(std::make_unique<Developer>("Carol"));
+    auto added = std::make_unique<Task>("Epsilon");
+    added->set_developer(theirs->find_developer("Carol"));
+    TaskId added_id = added->get_task_id();
+    theirs->find_column("Review")->add_task(std::move(added));
+    theirs->delete_task(id("Delta"));
+
+    MergeResult result = merge_boards(*base, *ours, *theirs);
+    EXPECT_TRUE(result.conflicts.empty());
+    EXPECT_EQ(result.applied, 4u);
+
+    Task* alpha = ours->find_task(id("Alpha"));
+    EXPECT_EQ(alpha->get_title(), "Alpha (ours)");
+    EXPECT_EQ(alpha->get_column(), ours->find_column("Done"));
+    Task* beta = ours->find_task(id("Beta"));
+    EXPECT_EQ(beta->get_priority(), 7);
+    EXPECT_EQ(beta->get_description(), "Details");
+    EXPECT_EQ(ours->find_task(id("Delta")), nullptr);
+    ASSERT_NE(ours->find_column("Review"), nullptr);
+    Task* epsilon = ours->find_task(added_id);
+    ASSERT_NE(epsilon, nullptr);
+    EXPECT_EQ(epsilon->get_column(), ours->find_column("Review"));
+    EXPECT_EQ(epsilon->get_developer(), ours->find_developer("Carol"));
+
+    // Повторное слияние ничего не меняет: изменения theirs уже в ours
+    result = merge_boards(*base, *ours, *theirs);
+    EXPECT_EQ(result.applied, 0u);
+    EXPECT_TRUE(result.conflicts.empty());
+    // ours отличается от theirs только своими изменениями: заголовок Alpha и приоритет Beta
+    EXPECT_EQ(diff_boards(*ours, *theirs).size(), 2u);
+}
+
+// Противоречивые изменения - конфликты, в ours остаются значения ours
+TEST_F(BoardDiffTest, MergeReportsConflicts) {
+    task(*ours, "Alpha")->set_title("Alpha (ours)");
+    task(*theirs, "Alpha")->set_title("Alpha (theirs)");
+    // Одинаковое изменение конфликтом не считается
+    task(*ours, "Beta")->set_priority(9);
+    task(*theirs, "Beta")->set_priority(9);
+    task(*ours, "Gamma")->set_developer(ours->find_developer("Bob"));
+    theirs->delete_task(id("Gamma"));
+    ours->delete_task(id("Delta"));
+    task(*theirs, "Delta")->set_description("Changed");
+
+    MergeResult result = merge_boards(*base, *ours, *theirs);
+    ASSERT_EQ(result.conflicts.size(), 3u);
+    EXPECT_EQ(result.applied, 0u);
+
+    const MergeConflict& title = result.conflicts[0];
+    EXPECT_EQ(title.kind, MergeConflict::Kind::BothChanged);
+    EXPECT_EQ(title.id, id("Alpha"));
+    EXPECT_EQ(title.field, unsigned(DiffTitle));
+    EXPECT_EQ(describe_conflict(title),
+              "! " + id("Alpha").to_string() + " title: ours 'Alpha (ours)', theirs 'Alpha (theirs)'");
+    EXPECT_EQ(result.conflicts[1].kind, MergeConflict::Kind::DeletedAndChanged);
+    EXPECT_EQ(result.conflicts[1].id, id("Delta"));
+    EXPECT_EQ(result.conflicts[2].kind, MergeConflict::Kind::ChangedAndDeleted);
+    EXPECT_EQ(result.conflicts[2].id, id("Gamma"));
+
+    EXPECT_EQ(ours->find_task(id("Alpha"))->get_title(), "Alpha (ours)");
+    EXPECT_NE(ours->find_task(id("Gamma")), nullptr);
+    EXPECT_EQ(ours->find_task(id("Delta")), nullptr);
+}
+
+// Сброс приоритета к значению по умолчанию в theirs не применяется и не выдается
+// за одновременную правку
+TEST_F(BoardDiffTest, MergeReportsUnsupportedPriorityReset) {
+    // Задача с тем же ID, но без приоритета
+    TaskId alpha = id("Alpha");
+    theirs->delete_task(alpha);
+    auto replacement = std::make_unique<Task>("Alpha", alpha);
+    replacement->set_developer(theirs->find_developer("Alice"));
+    theirs->find_column("Backlog")->add_task(std::move(replacement));
+    task(*theirs, "Beta")->set_title("Beta (theirs)");
+
+    MergeResult result = merge_boards(*base, *ours, *theirs);
+    ASSERT_EQ(result.conflicts.size(), 1u);
+    EXPECT_EQ(result.applied, 1u);
+    const MergeConflict& reset = result.conflicts[0];
+    EXPECT_EQ(reset.kind, MergeConflict::Kind::Unsupported);
+    EXPECT_EQ(reset.id, alpha);
+    EXPECT_EQ(reset.field, unsigned(DiffPriority));
+    EXPECT_EQ(describe_conflict(reset), "! " + alpha.to_string() + " priority: theirs '-1' cannot be applied, kept '1'");
+    EXPECT_EQ(ours->find_task(alpha)->get_priority(), 1);
+    EXPECT_EQ(task(*ours, "Beta (theirs)")->get_task_id(), id("Beta"));
+}
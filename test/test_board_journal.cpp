@@ -0,0 +1,181 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include "board.h"
+#include "board_journal.h"
+#include "board_loader.h"
+#include "column.h"
+#include "developer.h"
+#include "json_worker.h"
+#include "manager.h"
+#include "task.h"
+#include "test_files.h"
+
+// Test fixture с доской, изменения которой пишутся в журнал
+class BoardJournalTest : public FileTest {
+protected:
+    void SetUp() override {
+        FileTest::SetUp();
+        snapshot = path("board.json");
+
+        board = std::make_unique<Board>("Journal Board");
+        board->add_column(std::make_unique<Column>("Backlog"));
+        board->add_column(std::make_unique<Column>("Done"));
+        create_developer(*board, "Alice");
+        create_task(*board, "Backlog", "Existing");
+    }
+
+    static std::size_t count_lines(const std::string& file_path) {
+        std::ifstream file(file_path);
+        std::size_t lines = 0;
+        for (std::string line; std::getline(file, line);) {
+            ++lines;
+        }
+        return lines;
+    }
+
+    std::string snapshot;
+    std::unique_ptr<Board> board;
+};
+
+// После сбоя снимок и журнал восстанавливают точное состояние доски
+TEST_F(BoardJournalTest, RecoverReplaysChanges) {
+    {
+        BoardJournal journal(snapshot);
+        journal.attach(*board);
+
+        create_developer(*board, "Bob");
+        create_task(*board, "Backlog", "New task");
+        Task* task = board->find_column("Backlog")->find_task("New task");
+        task->set_description("Written after creation");
+        task->set_priority(7);
+        task->set_developer(board->find_developer("Bob"));
+        task->set_title("Renamed task");
+        board->move_task(task->get_task_id(), board->find_column("Done"));
+        board->find_column("Backlog")->delete_task("Existing");
+        board->delete_developer(board->find_developer("Alice"));
+        board->find_column("Done")->set_name("Finished");
+        EXPECT_EQ(journal.get_record_count(), 10);
+        // Журнал отключается без сжатия - как при падении процесса
+    }
+
+    Board restored("Restored");
+    BoardJournal journal(snapshot);
+    EXPECT_EQ(journal.recover(restored), 10);
+    EXPECT_EQ(dump(restored), dump(*board));
+
+    Task* task = restored.find_column("Finished")->find_task("Renamed task");
+    ASSERT_NE(task, nullptr);
+    EXPECT_EQ(task->get_developer(), restored.find_developer("Bob"));
+    EXPECT_EQ(restored.find_task(task->get_task_id()), task);
+
+    // Запись продолжается в тот же журнал
+    restored.find_column("Backlog")->add_task(std::make_unique<Task>("After recovery"));
+    EXPECT_EQ(journal.get_record_count(), 11);
+}
+
+// Сжатие пишет полный снимок и начинает журнал заново
+TEST_F(BoardJournalTest, SyncCompactsAtThreshold) {
+    BoardJournal journal(snapshot);
+    journal.set_compact_threshold(3);
+    journal.attach(*board);
+
+    create_task(*board, "Backlog", "One");
+    create_task(*board, "Backlog", "Two");
+    journal.sync();
+    EXPECT_EQ(journal.get_record_count(), 2);
+    EXPECT_EQ(count_lines(journal.get_journal_path()), 3);
+
+    create_task(*board, "Done", "Three");
+    journal.sync();
+    EXPECT_EQ(journal.get_record_count(), 0);
+    EXPECT_EQ(count_lines(journal.get_journal_path()), 1);
+
+    journal.detach();
+    Board restored("Restored");
+    BoardJournal reader(snapshot);
+    EXPECT_EQ(reader.recover(restored), 0);
+    EXPECT_EQ(dump(restored), dump(*board));
+}
+
+// Оборванная последняя запись отбрасывается и отрезается от файла
+TEST_F(BoardJournalTest, TornTailIsDropped) {
+    std::string path;
+    {
+        BoardJournal journal(snapshot);
+        journal.attach(*board);
+        create_task(*board, "Backlog", "Kept");
+        path = journal.get_journal_path();
+    }
+    {
+        std::ofstream file(path, std::ios::app);
+        file << "{\"op\":\"task_add\",\"column\":0,\"id\":\"to";
+    }
+
+    Board restored("Restored");
+    BoardJournal journal(snapshot);
+    EXPECT_EQ(journal.recover(restored), 1);
+    EXPECT_NE(restored.find_column("Backlog")->find_task("Kept"), nullptr);
+    EXPECT_EQ(count_lines(path), 2);
+
+    create_task(restored, "Done", "Appended");
+    journal.detach();
+    Board again("Again");
+    BoardJournal reader(snapshot);
+    EXPECT_EQ(reader.recover(again), 2);
+}
+
+// Журнал от другого снимка не применяется, поврежденная запись - ошибка со смещением
+TEST_F(BoardJournalTest, ForeignAndCorruptJournals) {
+    std::string path;
+    {
+        BoardJournal journal(snapshot);
+        journal.attach(*board);
+        create_task(*board, "Backlog", "Lost");
+        path = journal.get_journal_path();
+    }
+
+    // Снимок заменен в обход журнала - записи журнала к нему не относятся
+    Board other("Other");
+    other.add_column(std::make_unique<Column>("Only"));
+    Json_worker(snapshot).board_save(other);
+    Board restored("Restored");
+    {
+        BoardJournal journal(snapshot);
+        EXPECT_EQ(journal.recover(restored), 0);
+        EXPECT_EQ(restored.find_column("Backlog"), nullptr);
+        create_task(restored, "Only", "Task");
+    }
+
+    // Неизвестная операция в середине журнала
+    {
+        std::ofstream file(path, std::ios::app);
+        file << "{\"op\":\"unknown\"}\n";
+    }
+    Board broken("Broken");
+    BoardJournal journal(snapshot);
+    EXPECT_THROW(journal.recover(broken), BoardLoadError);
+}
+
+// Загрузка другой доски в отслеживаемую начинает журнал с нового снимка
+TEST_F(BoardJournalTest, LoadReplacesJournal) {
+    const std::string other_path = path("other.json");
+    Board other("Other");
+    other.add_column(std::make_unique<Column>("Only"));
+    create_task(other, "Only", "Loaded task");
+    Json_worker(other_path).board_save(other);
+
+    BoardJournal journal(snapshot);
+    journal.attach(*board);
+    create_task(*board, "Backlog", "Before load");
+    Json_worker(other_path).board_load(*board);
+    EXPECT_EQ(journal.get_record_count(), 0);
+
+    journal.detach();
+    Board restored("Restored");
+    BoardJournal reader(snapshot);
+    reader.recover(restored);
+    EXPECT_NE(restored.find_column("Only")->find_task("Loaded task"), nullptr);
+}
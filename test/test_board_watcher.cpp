@@ -0,0 +1,262 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "board.h"
+#include "board_watcher.h"
+#include "column.h"
+#include "developer.h"
+#include "json_worker.h"
+#include "manager.h"
+#include "task.h"
+#include "test_files.h"
+
+// Test fixture с доской, ее файлом и очередью задач потока доски
+// "Другой процесс" - копия доски, которая сохраняется в тот же файл
+class BoardWatcherTest : public FileTest {
+protected:
+    void SetUp() override {
+        FileTest::SetUp();
+        save_path = path("board.json");
+
+        board = std::make_unique<Board>("Watched");
+        board->add_column(std::make_unique<Column>("Backlog"));
+        board->add_column(std::make_unique<Column>("Done"));
+        create_developer(*board, "Alice");
+        create_task(*board, "Backlog", "First");
+        create_task(*board, "Backlog", "Second");
+        Json_worker(save_path).board_save(*board);
+    }
+
+    // Доска, загруженная из файла, - ее меняет и сохраняет "другой процесс"
+    std::unique_ptr<Board> external() const {
+        auto copy = std::make_unique<Board>("Watched");
+        Json_worker(save_path).board_load(*copy);
+        return copy;
+    }
+
+    // Сохранение "другого процесса": копия файла, записанного Json_worker, - у нее
+    // новый inode, поэтому WrittenFiles не считает ее записью этого процесса
+    void save_external(const Board& source) const {
+        const std::string written = path("external.json");
+        const std::string copy = path("external.copy");
+        Json_worker(written).board_save(source);
+        std::filesystem::copy_file(written, copy, std::filesystem::copy_options::overwrite_existing);
+        std::filesystem::rename(copy, save_path);
+    }
+
+    void post(std::function<void()> task) {
+        std::lock_guard<std::mutex> lock(queue_mutex);
+        queue.push_back(std::move(task));
+    }
+
+    // Выполнение задач, переданных в поток доски; false - очередь была пуста
+    bool run_queue() {
+        std::deque<std::function<void()>> tasks;
+        {
+            std::lock_guard<std::mutex> lock(queue_mutex);
+            tasks.swap(queue);
+        }
+        for (auto& task : tasks) {
+            task();
+        }
+        return !tasks.empty();
+    }
+
+    std::unique_ptr<BoardWatcher> watch() {
+        auto watcher = std::make_unique<BoardWatcher>(
+            *board, save_path, [this](std::function<void()> task) { post(std::move(task)); },
+            [this](const MergeResult& result) { merged.push_back(result); }, std::chrono::milliseconds(20));
+        // Исходная версия разобрана до возврата из конструктора
+        EXPECT_EQ(watcher->get_version_count(), 1u);
+        return watcher;
+    }
+
+    // Ожидание условия с ограничением по времени
+    static bool wait_for(const std::function<bool()>& condition) {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        while (!condition()) {
+            if (std::chrono::steady_clock::now() > deadline) {
+                return false;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+        return true;
+    }
+
+    std::string save_path;
+    std::unique_ptr<Board> board;
+    std::mutex queue_mutex;
+    std::deque<std::function<void()>> queue;
+    std::vector<MergeResult> merged;
+};
+
+// Изменения файла попадают в доску в ее потоке; несохраненные правки доски остаются
+TEST_F(BoardWatcherTest, MergesExternalChanges) {
+    auto watcher = watch();
+    TaskId first = board->find_column("Backlog")->find_task("First")->get_task_id();
+    TaskId second = board->find_column("Backlog")->find_task("Second")->get_task_id();
+    board->find_task(first)->set_title("First (local)");
+
+    auto other = external();
+    other->move_task(second, other->find_column("Done"));
+    create_developer(*other, "Bob");
+    other->find_task(first)->set_priority(4);
+    create_task(*other, "Backlog", "Third");
+    save_external(*other);
+
+    ASSERT_TRUE(wait_for([&] { return run_queue(); }));
+    ASSERT_EQ(merged.size(), 1u);
+    EXPECT_EQ(merged[0].applied, 3u);
+    EXPECT_TRUE(merged[0].conflicts.empty());
+    EXPECT_EQ(watcher->get_version_count(), 2u);
+
+    Task* task = board->find_task(first);
+    EXPECT_EQ(task->get_title(), "First (local)");
+    EXPECT_EQ(task->get_priority(), 4);
+    EXPECT_EQ(board->find_task(second)->get_column(), board->find_column("Done"));
+    EXPECT_NE(board->find_column("Backlog")->find_task("Third"), nullptr);
+    EXPECT_NE(board->find_developer("Bob"), nullptr);
+}
+
+// Собственное сохранение доски не сливается: правка после сохранения не становится
+// конфликтом, а следующее внешнее изменение сравнивается с сохраненной версией
+TEST_F(BoardWatcherTest, OwnSaveIsRebased) {
+    auto watcher = watch();
+    Task* first = board->find_column("Backlog")->find_task("First");
+    TaskId id = first->get_task_id();
+    first->set_title("Saved title");
+    create_task(*board, "Done", "Saved here");
+    Json_worker(save_path).board_save(*board);
+    first->set_title("Edited after save");
+
+    ASSERT_TRUE(wait_for([&] { return watcher->get_version_count() == 2; }));
+    EXPECT_FALSE(run_queue());
+    EXPECT_TRUE(merged.empty());
+    EXPECT_EQ(first->get_title(), "Edited after save");
+
+    auto other = external();
+    other->find_task(id)->set_priority(7);
+    save_external(*other);
+    ASSERT_TRUE(wait_for([&] { return run_queue(); }));
+    ASSERT_EQ(merged.size(), 1u);
+    EXPECT_EQ(merged[0].applied, 1u);
+    EXPECT_TRUE(merged[0].conflicts.empty());
+    EXPECT_EQ(first->get_title(), "Edited after save");
+    EXPECT_EQ(first->get_priority(), 7);
+    EXPECT_EQ(board->find_column("Done")->get_tasks().size(), 1u);
+
+    // Перезапись тем же содержимым другим процессом до потока доски не доходит
+    save_external(*other);
+    ASSERT_TRUE(wait_for([&] { return watcher->get_version_count() == 4; }));
+    EXPECT_FALSE(run_queue());
+    EXPECT_EQ(merged.size(), 1u);
+}
+
+// Запись другого процесса сразу после подключения - уже изменение, а не исходная версия
+TEST_F(BoardWatcherTest, ChangeRightAfterStartIsMerged) {
+    auto other = external();
+    create_task(*other, "Backlog", "Early");
+    auto watcher = watch();
+    save_external(*other);
+
+    ASSERT_TRUE(wait_for([&] { return run_queue(); }));
+    ASSERT_EQ(merged.size(), 1u);
+    EXPECT_EQ(merged[0].applied, 1u);
+    EXPECT_NE(board->find_column("Backlog")->find_task("Early"), nullptr);
+}
+
+// Недописанный файл пропускается; следующая целая версия сравнивается с последней разобранной
+TEST_F(BoardWatcherTest, BrokenFileIsSkipped) {
+    auto watcher = watch();
+    {
+        std::ofstream file(save_path, std::ios::trunc);
+        file << "{\"Watched\": {\"ids\": [";
+    }
+    ASSERT_TRUE(wait_for([&] { return !watcher->get_last_error().empty(); }));
+    EXPECT_FALSE(run_queue());
+    EXPECT_EQ(board->find_column("Backlog")->get_tasks().size(), 2u);
+
+    auto other = std::make_unique<Board>("Watched");
+    other->add_column(std::make_unique<Column>("Backlog"));
+    other->add_column(std::make_unique<Column>("Done"));
+    create_developer(*other, "Alice");
+    create_task(*other, "Done", "Replacement");
+    save_external(*other);
+
+    ASSERT_TRUE(wait_for([&] { return run_queue(); }));
+    EXPECT_TRUE(watcher->get_last_error().empty());
+    // Задачи прежней версии удалены, новая добавлена
+    ASSERT_EQ(merged.size(), 1u);
+    EXPECT_EQ(merged[0].applied, 3u);
+    EXPECT_TRUE(board->find_column("Backlog")->get_tasks().empty());
+    EXPECT_NE(board->find_column("Done")->find_task("Replacement"), nullptr);
+}
+
+// Задачи, оставшиеся в очереди после удаления наблюдателя, ничего не делают
+TEST_F(BoardWatcherTest, PendingMergeIsCancelled) {
+    auto watcher = watch();
+    auto other = external();
+    create_task(*other, "Backlog", "Late");
+    save_external(*other);
+    ASSERT_TRUE(wait_for([&] {
+        std::lock_guard<std::mutex> lock(queue_mutex);
+        return !queue.empty();
+    }));
+    watcher.reset();
+    EXPECT_TRUE(run_queue());
+    EXPECT_TRUE(merged.empty());
+    EXPECT_EQ(board->find_column("Backlog")->find_task("Late"), nullptr);
+}
+
+// Поток наблюдателя создает и удаляет разработчиков разобранных версий файла,
+// пока поток доски добавляет и удаляет своих
+TEST_F(BoardWatcherTest, DevelopersChangeDuringReload) {
+    auto watcher = watch();
+    auto other = external();
+    for (int d = 0; d < 20; ++d) {
+        create_developer(*other, "Remote " + std::to_string(d));
+    }
+    for (int i = 0; i < 100; ++i) {
+        create_task(*other, "Backlog", "Remote task " + std::to_string(i));
+    }
+
+    Task local("Local");
+    int churn = 0;
+    for (int version = 0; version < 5; ++version) {
+        const auto& developers = other->get_developers();
+        for (int i = 0; i < 100; ++i) {
+            Task* task = other->find_column("Backlog")->find_task("Remote task " + std::to_string(i));
+            task->set_developer(developers[(i + version) % developers.size()].get());
+        }
+        save_external(*other);
+
+        // Поток доски меняет разработчиков, пока изменения файла не дошли до него
+        ASSERT_TRUE(wait_for([&] {
+            std::string name = "Local " + std::to_string(churn++);
+            board->add_developer(std::make_unique<Developer>(name));
+            Developer* developer = board->find_developer(name);
+            local.set_developer(developer);
+            EXPECT_EQ(local.get_developer(), developer);
+            board->delete_developer(developer);
+            EXPECT_EQ(local.get_developer(), nullptr);
+            return run_queue();
+        }));
+    }
+
+    EXPECT_EQ(merged.size(), 5u);
+    const auto& developers = other->get_developers();
+    for (int i = 0; i < 100; ++i) {
+        Task* task = board->find_column("Backlog")->find_task("Remote task " + std::to_string(i));
+        ASSERT_NE(task, nullptr);
+        ASSERT_NE(task->get_developer(), nullptr);
+        EXPECT_EQ(task->get_developer()->get_name(), developers[(i + 4) % developers.size()]->get_name());
+    }
+}
@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 #include <memory>
+#include <stdexcept>
+#include <vector>
 #include "column.h"
 #include "task.h"
 #include "board.h"
@@ -48,10 +50,10 @@ TEST_F(ColumnTest, AddAndGetTasks) {
     
     // Проверки
     EXPECT_EQ(tasks.size(), 2);                    // Должно быть 2 задачи
-    EXPECT_EQ(tasks[0].get(), task1_ptr);          // Первая задача соответствует ожидаемой
-    EXPECT_EQ(tasks[1].get(), task2_ptr);          // Вторая задача соответствует ожидаемой
-    EXPECT_EQ(tasks[0]->get_title(), "Task 1");    // Проверка заголовка первой задачи
-    EXPECT_EQ(tasks[1]->get_title(), "Task 2");    // Проверка заголовка второй задачи
+    EXPECT_EQ(tasks.nth(0).get(), task1_ptr);          // Первая задача соответствует ожидаемой
+    EXPECT_EQ(tasks.nth(1).get(), task2_ptr);          // Вторая задача соответствует ожидаемой
+    EXPECT_EQ(tasks.nth(0)->get_title(), "Task 1");    // Проверка заголовка первой задачи
+    EXPECT_EQ(tasks.nth(1)->get_title(), "Task 2");    // Проверка заголовка второй задачи
 }
 
 // Тест удаления задач из колонки
@@ -68,7 +70,7 @@ TEST_F(ColumnTest, DeleteTask) {
     // Удаление задачи по заголовку
     column->delete_task("Task 1");
     EXPECT_EQ(column->get_tasks().size(), 1);  // Должна остаться одна задача
-    EXPECT_EQ(column->get_tasks()[0]->get_title(), "Task 2");  // Проверка оставшейся задачи
+    EXPECT_EQ(column->get_tasks().nth(0)->get_title(), "Task 2");  // Проверка оставшейся задачи
     
     // Попытка удаления несуществующей задачи должна вызывать исключение
     EXPECT_THROW(column->delete_task("NonExistent"), std::runtime_error);
@@ -122,7 +124,7 @@ TEST_F(ColumnTest, MoveTaskBetweenColumns) {
     // Проверка конечного состояния
     EXPECT_TRUE(start_column->get_tasks().empty());  // Исходная колонка теперь пуста
     EXPECT_EQ(end_column->get_tasks().size(), 1);    // В целевой колонке 1 задача
-    EXPECT_EQ(end_column->get_tasks()[0].get(), task_ptr);  // Задача соответствует перемещенной
+    EXPECT_EQ(end_column->get_tasks().nth(0).get(), task_ptr);  // Задача соответствует перемещенной
 }
 
 // Тест поиска задачи на всей доске
@@ -149,4 +151,112 @@ TEST_F(ColumnTest, SearchTaskInBoard) {
     // Проверка обработки ошибок - поиск несуществующих задач
     EXPECT_THROW(search_task(*board, "Backlog", "NonExistent"), std::runtime_error);
     EXPECT_THROW(search_task(*board, "NonExistent", "Task"), std::runtime_error);
-}
\ No newline at end of file
+}
+// Тест согласованности индекса заголовков при переименовании задачи
+TEST_F(ColumnTest, FindTaskAfterRename) {
+    auto task = std::make_unique<Task>("Old Title");
+    Task* task_ptr = task.get();
+    column->add_task(std::move(task));
+    
+    // Переименование через задачу обновляет индекс колонки
+    task_ptr->set_title("New Title");
+    
+    EXPECT_EQ(column->find_task("Old Title"), nullptr);   // Старый заголовок не найден
+    EXPECT_EQ(column->find_task("New Title"), task_ptr);  // Новый заголовок найден
+    EXPECT_EQ(task_ptr->get_column(), column.get());      // Задача знает свою колонку
+    
+    // Удаление по новому заголовку
+    column->delete_task("New Title");
+    EXPECT_TRUE(column->get_tasks().empty());
+}
+
+// Тест индекса заголовков при перемещении задачи
+TEST_F(ColumnTest, FindTaskAfterMove) {
+    auto end_column = std::make_unique<Column>("End");
+    auto task = std::make_unique<Task>("Movable Task");
+    Task* task_ptr = task.get();
+    column->add_task(std::move(task));
+    
+    move_task(column.get(), end_column.get(), task_ptr);
+    
+    EXPECT_EQ(column->find_task("Movable Task"), nullptr);         // Исходная колонка ее не находит
+    EXPECT_EQ(end_column->find_task("Movable Task"), task_ptr);    // Целевая колонка находит
+    EXPECT_EQ(task_ptr->get_column(), end_column.get());
+}
+
+// Тест задач с одинаковыми заголовками
+TEST_F(ColumnTest, DuplicateTitles) {
+    column->add_task(std::make_unique<Task>("Same"));
+    column->add_task(std::make_unique<Task>("Same"));
+    
+    // Удаление убирает ровно одну задачу, вторая остается доступной через индекс
+    column->delete_task("Same");
+    EXPECT_EQ(column->get_tasks().size(), 1);
+    EXPECT_EQ(column->find_task("Same"), column->get_tasks().nth(0).get());
+    
+    column->delete_task("Same");
+    EXPECT_TRUE(column->get_tasks().empty());
+    EXPECT_EQ(column->find_task("Same"), nullptr);
+}
+
+// Пакетное добавление: порядок, индексы колонки и доски, одно изменение ревизии
+TEST_F(ColumnTest, AddTasksBatch) {
+    board->add_column(std::move(column));
+    Column* col = board->find_column("Test Column");
+    board->add_developer(std::make_unique<Developer>("Lead"));
+    col->add_task(std::make_unique<Task>("First"));
+
+    std::vector<std::unique_ptr<Task>> batch;
+    batch.push_back(std::make_unique<Task>("Second"));
+    batch.push_back(std::make_unique<Task>("Third"));
+    batch.back()->set_developer(board->find_developer("Lead"));
+    TaskId second_id = batch.front()->get_task_id();
+    auto revision = col->get_revision();
+    col->add_tasks(std::move(batch));
+
+    EXPECT_GT(col->get_revision(), revision);
+    ASSERT_EQ(col->get_tasks().size(), 3u);
+    EXPECT_EQ(col->get_tasks().nth(1)->get_title(), "Second");
+    EXPECT_EQ(col->get_tasks().nth(2)->get_title(), "Third");
+    EXPECT_EQ(col->find_task("Third")->get_column(), col);
+    EXPECT_EQ(board->find_task(second_id), col->find_task("Second"));
+    EXPECT_EQ(board->get_developer_tasks(board->find_developer("Lead")).size(), 1u);
+
+    // nullptr в пакете - колонка не меняется
+    std::vector<std::unique_ptr<Task>> broken;
+    broken.push_back(std::make_unique<Task>("Fourth"));
+    broken.push_back(nullptr);
+    EXPECT_THROW(col->add_tasks(std::move(broken)), std::invalid_argument);
+    EXPECT_EQ(col->get_tasks().size(), 3u);
+}
+
+// Индекс заголовков после пакетного добавления строится при первом поиске
+// и учитывает переименования и извлечения, сделанные до него
+TEST_F(ColumnTest, DeferredTitleIndex) {
+    column->add_task(std::make_unique<Task>("Before"));
+    std::vector<std::unique_ptr<Task>> batch;
+    for (const char* title : {"One", "Two", "Three"}) {
+        batch.push_back(std::make_unique<Task>(title));
+    }
+    Task* two = batch[1].get();
+    Task* three = batch[2].get();
+    column->add_tasks(std::move(batch));
+
+    two->set_title("Two renamed");
+    auto taken = column->take_task(three);
+
+    EXPECT_NE(column->find_task("Before"), nullptr);
+    EXPECT_EQ(column->find_task("Two renamed"), two);
+    EXPECT_EQ(column->find_task("Two"), nullptr);
+    EXPECT_EQ(column->find_task("Three"), nullptr);
+
+    // После построения индекс снова ведется при каждом изменении
+    two->set_title("Two again");
+    column->add_task(std::make_unique<Task>("After"));
+    EXPECT_EQ(column->find_task("Two again"), two);
+    EXPECT_EQ(column->find_task("Two renamed"), nullptr);
+    EXPECT_NE(column->find_task("After"), nullptr);
+    column->delete_task("One");
+    EXPECT_EQ(column->find_task("One"), nullptr);
+    EXPECT_EQ(column->get_tasks().size(), 3u);
+}
@@ -0,0 +1,96 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <vector>
+#include "column.h"
+#include "column_viewport.h"
+#include "task.h"
+
+// Test fixture для окна прокрутки колонки
+class ColumnViewportTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        column = std::make_unique<Column>("Backlog");
+        for (int i = 0; i < 100; ++i) {
+            column->add_task(std::make_unique<Task>("T" + std::to_string(i)));
+        }
+    }
+
+    // Заголовки видимых задач
+    std::vector<std::string> window(const Column& source, std::size_t rows) {
+        std::vector<std::string> titles;
+        for (const Task* task : viewport.visible_tasks(source, rows)) {
+            titles.emplace_back(task->get_title());
+        }
+        return titles;
+    }
+
+    static std::vector<std::string> range(int first, int count) {
+        std::vector<std::string> titles;
+        for (int i = first; i < first + count; ++i) {
+            titles.push_back("T" + std::to_string(i));
+        }
+        return titles;
+    }
+
+    std::unique_ptr<Column> column;
+    ColumnViewport viewport;
+};
+
+// Прокрутка в пределах колонки; у краев окно не сдвигается
+TEST_F(ColumnViewportTest, ScrollStaysInsideColumn) {
+    EXPECT_EQ(window(*column, 10), range(0, 10));
+    EXPECT_FALSE(viewport.scroll(-1, 100));
+    EXPECT_TRUE(viewport.scroll(5, 100));
+    EXPECT_EQ(window(*column, 10), range(5, 10));
+
+    EXPECT_TRUE(viewport.scroll(1000, 100));
+    EXPECT_EQ(viewport.get_offset(), 90u);
+    EXPECT_EQ(window(*column, 10), range(90, 10));
+    EXPECT_FALSE(viewport.scroll(1, 100));
+
+    // Окно стало выше - конец колонки остается внизу окна
+    EXPECT_EQ(window(*column, 20), range(80, 20));
+    EXPECT_TRUE(viewport.scroll(-1000, 100));
+    EXPECT_EQ(window(*column, 20), range(0, 20));
+    EXPECT_EQ(window(*column, 0), range(0, 1));
+}
+
+// После изменения колонки окно показывает задачи по той же позиции
+TEST_F(ColumnViewportTest, FollowsColumnChanges) {
+    viewport.scroll(50, 100);
+    EXPECT_EQ(window(*column, 5), range(50, 5));
+
+    column->delete_task("T10");
+    column->delete_task("T52");
+    EXPECT_EQ(window(*column, 5), (std::vector<std::string>{"T51", "T53", "T54", "T55", "T56"}));
+
+    column->add_task(std::make_unique<Task>("Extra"));
+    EXPECT_EQ(window(*column, 3), (std::vector<std::string>{"T51", "T53", "T54"}));
+    viewport.scroll(1000, column->get_tasks().size());
+    EXPECT_EQ(window(*column, 3), (std::vector<std::string>{"T98", "T99", "Extra"}));
+
+    // Колонка стала короче окна
+    for (int i = 0; i < 100; ++i) {
+        if (i != 10 && i != 52) {
+            column->delete_task("T" + std::to_string(i));
+        }
+    }
+    EXPECT_EQ(window(*column, 3), (std::vector<std::string>{"Extra"}));
+    EXPECT_EQ(viewport.get_offset(), 0u);
+
+    Column empty("Empty");
+    EXPECT_TRUE(viewport.visible_tasks(empty, 3).empty());
+}
+
+// Одно окно на разных колонках: запомненная позиция другой колонки не используется
+TEST_F(ColumnViewportTest, SwitchesColumns) {
+    Column other("Other");
+    for (int i = 0; i < 10; ++i) {
+        other.add_task(std::make_unique<Task>("O" + std::to_string(i)));
+    }
+    viewport.scroll(95, 100);
+    EXPECT_EQ(window(*column, 5), range(95, 5));
+    EXPECT_EQ(window(other, 5), (std::vector<std::string>{"O5", "O6", "O7", "O8", "O9"}));
+    EXPECT_EQ(window(*column, 5), range(5, 5));
+}
@@ -0,0 +1,240 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <unordered_set>
+#include "board.h"
+#include "board_loader.h"
+#include "column.h"
+#include "csv_worker.h"
+#include "developer.h"
+#include "id_allocator.h"
+#include "json_worker.h"
+#include "task.h"
+#include "test_files.h"
+
+// Test fixture для импорта и экспорта CSV/TSV
+class CsvWorkerTest : public FileTest {
+protected:
+    void SetUp() override {
+        FileTest::SetUp();
+        // Разделители и перевод строки в полях, которые нужно заключать в кавычки
+        board = make_sample_board("Test Board", {"Backlog", "In, Progress"});
+        Task* task1 = board->find_column("Backlog")->find_task("Task \"quoted\"");
+        task1->set_description("Line one\nLine two, with comma");
+        board->find_column("Backlog")->find_task("Task 2")->set_title("Task\t2");
+        board->find_column("In, Progress")->find_task("Task 3")->set_priority(0);
+    }
+
+    std::unique_ptr<Board> board;
+};
+
+// Экспорт: заголовок, поля по порядку, кавычки только там, где нужны
+TEST_F(CsvWorkerTest, ExportFormat) {
+    Csv_worker csv(path("board.csv"));
+    EXPECT_EQ(csv.get_delimiter(), ',');
+    EXPECT_EQ(csv.board_export(*board), 3u);
+
+    const auto& backlog = board->find_column("Backlog")->get_tasks();
+    std::string expected =
+        "column,title,id,priority,developer,description\n"
+        "Backlog,\"Task \"\"quoted\"\"\"," + backlog.nth(0)->get_id() + ",5,Alice,\"Line one\nLine two, with comma\"\n"
+        "Backlog,Task\t2," + backlog.nth(1)->get_id() + ",,,\n"
+        "\"In, Progress\",Task 3," + board->find_column("In, Progress")->get_tasks().nth(0)->get_id() + ",0,Bob,\n";
+    EXPECT_EQ(read_file(path("board.csv")), expected);
+
+    // TSV: табуляция в заголовке задачи требует кавычек, запятая - нет
+    Csv_worker tsv(path("board.TSV"));
+    EXPECT_EQ(tsv.get_delimiter(), '\t');
+    tsv.board_export(*board);
+    std::string text = read_file(path("board.TSV"));
+    EXPECT_NE(text.find("Backlog\t\"Task\t2\"\t"), std::string::npos);
+    EXPECT_NE(text.find("\nIn, Progress\tTask 3\t"), std::string::npos);
+}
+
+// Экспорт и импорт в пустую доску дают ту же доску (ID сохраняются)
+TEST_F(CsvWorkerTest, RoundTrip) {
+    for (const char* name : {"board.csv", "board.tsv"}) {
+        SCOPED_TRACE(name);
+        Csv_worker(path(name)).board_export(*board);
+        Board copy("Test Board");
+        EXPECT_EQ(Csv_worker(path(name)).board_import(copy), 3u);
+        EXPECT_EQ(dump(copy), dump(*board));
+    }
+}
+
+// ID с разделителем, кавычкой и переводом строки экранируется как остальные поля
+TEST_F(CsvWorkerTest, RoundTripForeignIds) {
+    Column* backlog = board->find_column("Backlog");
+    backlog->find_task("Task\t2")->set_id("a,\"b");
+    board->find_column("In, Progress")->find_task("Task 3")->set_id("c\td\ne");
+    for (const char* name : {"board.csv", "board.tsv"}) {
+        SCOPED_TRACE(name);
+        Csv_worker(path(name)).board_export(*board);
+        Board copy("Test Board");
+        EXPECT_EQ(Csv_worker(path(name)).board_import(copy), 3u);
+        EXPECT_EQ(dump(copy), dump(*board));
+        ASSERT_NE(copy.find_task(TaskId::from_string("a,\"b")), nullptr);
+        EXPECT_EQ(copy.find_task(TaskId::from_string("a,\"b"))->get_title(), "Task\t2");
+    }
+}
+
+// Импорт в ту же доску добавляет задачи в конец колонок с новыми ID
+TEST_F(CsvWorkerTest, ImportAppendsWithFreshIds) {
+    Csv_worker csv(path("board.csv"));
+    csv.board_export(*board);
+    csv.board_import(*board);
+
+    ASSERT_EQ(board->get_columns().size(), 2u);
+    ASSERT_EQ(board->get_developers().size(), 2u);
+    Column* backlog = board->find_column("Backlog");
+    ASSERT_EQ(backlog->get_tasks().size(), 4u);
+    EXPECT_EQ(backlog->get_tasks().nth(2)->get_title(), "Task \"quoted\"");
+    EXPECT_EQ(backlog->get_tasks().nth(2)->get_developer(), board->find_developer("Alice"));
+    std::unordered_set<TaskId> ids;
+    for (const auto& column : board->get_columns()) {
+        for (const auto& task : column->get_tasks()) {
+            EXPECT_TRUE(ids.insert(task->get_task_id()).second);
+            EXPECT_EQ(board->find_task(task->get_task_id()), task.get());
+        }
+    }
+    EXPECT_EQ(board->get_developer_tasks(board->find_developer("Bob")).size(), 2u);
+}
+
+// Повторный ID внутри файла заменяется новым; индекс доски остается согласованным
+TEST_F(CsvWorkerTest, ImportRenamesDuplicateIds) {
+    write_file(path("duplicates.csv"),
+        "column,title,id\n"
+        "Backlog,a,abc123\n"
+        "Backlog,b,abc123\n");
+    EXPECT_EQ(Csv_worker(path("duplicates.csv")).board_import(*board), 2u);
+
+    Column* backlog = board->find_column("Backlog");
+    Task* a = backlog->find_task("a");
+    Task* b = backlog->find_task("b");
+    ASSERT_NE(a, nullptr);
+    ASSERT_NE(b, nullptr);
+    EXPECT_EQ(a->get_id(), "abc123");
+    EXPECT_NE(b->get_id(), "abc123");
+    EXPECT_EQ(board->find_task(a->get_task_id()), a);
+    EXPECT_EQ(board->find_task(b->get_task_id()), b);
+
+    TaskId b_id = b->get_task_id();
+    board->delete_task(TaskId::from_string("abc123"));
+    EXPECT_EQ(backlog->find_task("a"), nullptr);
+    EXPECT_EQ(board->find_task(TaskId::from_string("abc123")), nullptr);
+    EXPECT_EQ(backlog->find_task("b"), b);
+    EXPECT_EQ(board->find_task(b_id), b);
+
+    // Новый ID освобождается вместе с задачей
+    board->delete_task(b_id);
+    EXPECT_EQ(board->find_task(b_id), nullptr);
+    EXPECT_FALSE(IdAllocator::instance().contains(b_id));
+}
+
+// Поля в любом порядке, незнакомые поля, BOM, CRLF, пустые строки и недостающие поля
+TEST_F(CsvWorkerTest, ImportAcceptsLooseFiles) {
+    write_file(path("loose.csv"),
+        "\xEF\xBB\xBF" "Title,Estimate,Column,Priority,Developer,Description\r\n"
+        "\r\n"
+        "First,3,Todo,-1,Carol,\"multi\r\nline\"\r\n"
+        "Second,,Todo,7\r\n"
+        "\"Third\",1,\"Review\",,,\"\"\r\n"
+        "\n");
+    Board imported("Imported");
+    EXPECT_EQ(Csv_worker(path("loose.csv")).board_import(imported), 3u);
+
+    ASSERT_NE(imported.find_column("Todo"), nullptr);
+    ASSERT_NE(imported.find_column("Review"), nullptr);
+    ASSERT_NE(imported.find_developer("Carol"), nullptr);
+    Task* first = imported.find_column("Todo")->find_task("First");
+    ASSERT_NE(first, nullptr);
+    EXPECT_EQ(first->get_priority(), -1);
+    EXPECT_EQ(first->get_description(), "multi\r\nline");
+    EXPECT_EQ(first->get_developer(), imported.find_developer("Carol"));
+    Task* second = imported.find_column("Todo")->find_task("Second");
+    ASSERT_NE(second, nullptr);
+    EXPECT_EQ(second->get_priority(), 7);
+    EXPECT_EQ(second->get_developer(), nullptr);
+    EXPECT_NE(imported.find_column("Review")->find_task("Third"), nullptr);
+}
+
+// Ошибка импорта не меняет доску; ошибки формата несут смещение записи
+TEST_F(CsvWorkerTest, ImportErrorsKeepBoard) {
+    const std::string before = dump(*board);
+    auto expect_error = [&](const std::string& text, std::size_t offset, bool create = true) {
+        write_file(path("broken.csv"), text);
+        Csv_worker csv(path("broken.csv"));
+        csv.set_create_missing(create);
+        try {
+            csv.board_import(*board);
+            ADD_FAILURE() << "Expected BoardLoadError for: " << text;
+        } catch (const BoardLoadError& e) {
+            EXPECT_EQ(e.get_offset(), offset) << e.what();
+        }
+        EXPECT_EQ(dump(*board), before);
+    };
+
+    const std::string header = "column,title,priority,developer\n";
+    expect_error("title,priority\nTask,1\n", 0);
+    expect_error(header + "Backlog,,1,\n", header.size());
+    expect_error(header + "Backlog,Ok,1,\nBacklog,Bad,high,\n", header.size() + 14);
+    expect_error(header + "Backlog,\"Open\n", header.size() + 8);
+    expect_error(header + "Backlog,\"Closed\"x,1,\n", header.size() + 16);
+    expect_error(header + "Back\"log,Task,1,\n", header.size() + 4);
+    expect_error(header + "Backlog,Ok,1,\nNowhere,Task,1,\n", header.size() + 14, false);
+    expect_error(header + "Backlog,Ok,1,Nobody\n", header.size(), false);
+
+    // Неверный приоритет - ошибка модели, как при загрузке JSON
+    write_file(path("broken.csv"), header + "Backlog,Task,42,\n");
+    EXPECT_THROW(Csv_worker(path("broken.csv")).board_import(*board), std::invalid_argument);
+    EXPECT_EQ(dump(*board), before);
+}
+
+// Параллельный разбор дает ту же доску и ту же ошибку, что и последовательный
+TEST_F(CsvWorkerTest, ParallelImportMatchesSequential) {
+    Column* backlog = board->find_column("Backlog");
+    for (int i = 0; i < 40000; ++i) {
+        auto task = std::make_unique<Task>("Bulk, \"" + std::to_string(i) + "\"");
+        task->set_description("Line\n\"" + std::to_string(i) + "\"\nsecond line of the description");
+        task->set_priority(i % 11);
+        task->set_developer(board->find_developer(i % 2 ? "Alice" : "Bob"));
+        backlog->add_task(std::move(task));
+    }
+    Csv_worker(path("big.csv")).board_export(*board);
+    ASSERT_GT(std::filesystem::file_size(path("big.csv")), 2u << 20);
+
+    Board sequential("Test Board");
+    Csv_worker(path("big.csv")).board_import(sequential);
+    Board parallel("Test Board");
+    parallel.enable_arena();
+    Csv_worker csv(path("big.csv"));
+    csv.set_threads(4);
+    EXPECT_EQ(csv.board_import(parallel), 40003u);
+    EXPECT_TRUE(dump(parallel) == dump(sequential));
+    EXPECT_TRUE(dump(parallel) == dump(*board));
+    EXPECT_GE(parallel.get_arena()->get_live_objects(), 40003u);
+
+    // Ошибка в последней части файла
+    std::string text = read_file(path("big.csv"));
+    const std::string title = "\"Bulk, \"\"29000\"\"\",";
+    std::size_t id = text.find(title) + title.size();
+    text.insert(text.find(',', id) + 1, "x");
+    write_file(path("big.csv"), text);
+    std::string sequential_error, parallel_error;
+    try {
+        Board target("Target");
+        Csv_worker(path("big.csv")).board_import(target);
+    } catch (const BoardLoadError& e) {
+        sequential_error = e.what();
+    }
+    try {
+        Board target("Target");
+        csv.board_import(target);
+    } catch (const BoardLoadError& e) {
+        parallel_error = e.what();
+    }
+    EXPECT_NE(sequential_error.find("Priority is not a number"), std::string::npos);
+    EXPECT_EQ(parallel_error, sequential_error);
+}
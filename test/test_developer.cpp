@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 #include <memory>
+#include "board.h"
 #include "developer.h"
 
 // Test fixture класс для тестирования Developer
@@ -48,4 +49,18 @@ TEST_F(DeveloperTest, MultipleDevelopers) {
     EXPECT_EQ(dev1->get_name(), "Developer One");
     EXPECT_EQ(dev2->get_name(), "Developer Two");
     EXPECT_EQ(dev3->get_name(), "Developer Three");
-}
\ No newline at end of file
+}
+
+// Тест присваивания разработчика на доске: индекс имен следует за новым именем
+TEST_F(DeveloperTest, AssignmentUpdatesBoardIndex) {
+    Board board("Board");
+    board.add_developer(std::make_unique<Developer>("Alice"));
+    Developer* alice = board.find_developer("Alice");
+    Developer bob("Bob with a name longer than the small string buffer");
+
+    *alice = bob;
+    EXPECT_EQ(alice->get_name(), "Bob with a name longer than the small string buffer");
+    EXPECT_NE(alice->get_handle(), bob.get_handle());
+    EXPECT_EQ(board.find_developer("Alice"), nullptr);
+    EXPECT_EQ(board.find_developer("Bob with a name longer than the small string buffer"), alice);
+}
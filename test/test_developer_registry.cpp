@@ -0,0 +1,113 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "board.h"
+#include "column.h"
+#include "developer.h"
+#include "developer_registry.h"
+#include "task.h"
+
+// Тест разрешения handle в разработчика
+TEST(DeveloperRegistryTest, HandleResolves) {
+    Developer dev("Alice");
+    DeveloperHandle handle = dev.get_handle();
+    EXPECT_TRUE(handle.valid());
+    EXPECT_EQ(DeveloperRegistry::instance().get(handle), &dev);
+    
+    // Пустой handle ни на кого не указывает
+    EXPECT_EQ(DeveloperRegistry::instance().get(DeveloperHandle()), nullptr);
+}
+
+// Тест устаревания handle после удаления разработчика
+TEST(DeveloperRegistryTest, StaleHandle) {
+    DeveloperHandle old_handle;
+    {
+        Developer dev("Bob");
+        old_handle = dev.get_handle();
+    }
+    EXPECT_EQ(DeveloperRegistry::instance().get(old_handle), nullptr);
+    
+    // Слот используется повторно, но с новым поколением
+    Developer reused("Carol");
+    EXPECT_EQ(reused.get_handle().index(), old_handle.index());
+    EXPECT_NE(reused.get_handle(), old_handle);
+    EXPECT_EQ(DeveloperRegistry::instance().get(old_handle), nullptr);
+}
+
+// Тест задачи, чей разработчик удален вне доски
+TEST(DeveloperRegistryTest, TaskDeveloperExpires) {
+    Task task("Task");
+    auto dev = std::make_unique<Developer>("Dave");
+    task.set_developer(dev.get());
+    EXPECT_EQ(task.get_developer(), dev.get());
+    
+    dev.reset();
+    EXPECT_EQ(task.get_developer(), nullptr);
+    
+    // Новый разработчик по тому же адресу или слоту не получает чужую задачу
+    Developer other("Eve");
+    EXPECT_EQ(task.get_developer(), nullptr);
+}
+
+// Тест удаления разработчика с доски без обхода задач
+TEST(DeveloperRegistryTest, BoardDeleteExpiresHandles) {
+    Board board("Board");
+    board.add_column(std::make_unique<Column>("Backlog"));
+    board.add_developer(std::make_unique<Developer>("Frank"));
+    Column* backlog = board.find_column("Backlog");
+    Developer* frank = board.find_developer("Frank");
+    backlog->add_task(std::make_unique<Task>("Task"));
+    Task* task = backlog->find_task("Task");
+    task->set_developer(frank);
+    
+    board.clear_developers();
+    EXPECT_EQ(task->get_developer(), nullptr);
+    
+    // Разработчик с тем же именем - другой объект, задача остается без назначения
+    board.add_developer(std::make_unique<Developer>("Frank"));
+    Developer* new_frank = board.find_developer("Frank");
+    EXPECT_EQ(task->get_developer(), nullptr);
+    EXPECT_TRUE(board.get_developer_tasks(new_frank).empty());
+    
+    // Переназначение и перемещение после удаления работают как обычно
+    task->set_developer(new_frank);
+    EXPECT_EQ(board.get_developer_tasks(new_frank).count(task), 1);
+}
+
+// Тест исчерпания поколений: слот выводится из оборота, старый handle не оживает
+TEST(DeveloperRegistryTest, ExhaustedSlotIsRetired) {
+    DeveloperHandle first;
+    {
+        Developer dev("Grace");
+        first = dev.get_handle();
+    }
+    for (uint32_t i = 0; i < DeveloperHandle::max_generation + 10; ++i) {
+        Developer dev("Heidi");
+        ASSERT_NE(dev.get_handle(), first);
+        ASSERT_EQ(DeveloperRegistry::instance().get(first), nullptr);
+    }
+}
+
+// Тест регистрации разработчиков из нескольких потоков одновременно
+TEST(DeveloperRegistryTest, ConcurrentAddRemove) {
+    std::size_t before = DeveloperRegistry::instance().size();
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([] {
+            for (int i = 0; i < 2000; ++i) {
+                Developer dev("Ivan");
+                Developer copy(dev);
+                if (DeveloperRegistry::instance().get(dev.get_handle()) != &dev ||
+                    DeveloperRegistry::instance().get(copy.get_handle()) != &copy) {
+                    ADD_FAILURE() << "Handle resolves to another developer";
+                    return;
+                }
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(DeveloperRegistry::instance().size(), before);
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <initializer_list>
+#include <memory>
+#include <sstream>
+#include <string>
+#include "board.h"
+#include "column.h"
+#include "developer.h"
+#include "json_worker.h"
+#include "task.h"
+
+// Общий test fixture для тестов, работающих с файлами
+// Каждый тест получает свой временный каталог, который удаляется после теста
+class FileTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // Имя набора тестов в имени каталога: наборы не мешают друг другу
+        const std::string suite = ::testing::UnitTest::GetInstance()->current_test_info()->test_suite_name();
+        dir = std::filesystem::temp_directory_path() / ("scrum_board_" + suite + "_" + std::to_string(::testing::UnitTest::GetInstance()->random_seed()));
+        std::filesystem::create_directories(dir);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(dir);
+    }
+
+    std::string path(const std::string& name) const {
+        return (dir / name).string();
+    }
+
+    static std::string read_file(const std::string& file_path) {
+        std::ifstream file(file_path, std::ios::binary);
+        std::stringstream buffer;
+        buffer << file.rdbuf();
+        return buffer.str();
+    }
+
+    static void write_file(const std::string& file_path, const std::string& text) {
+        std::ofstream file(file_path, std::ios::binary);
+        file << text;
+    }
+
+    // JSON доски - для сравнения досок целиком
+    std::string dump(const Board& source) const {
+        Json_worker(path("dump.json")).board_save(source);
+        return read_file(path("dump.json"));
+    }
+
+    // Доска для проверки форматов: кавычки и перевод строки в полях,
+    // задача без приоритета и разработчика
+    // Задачи лежат в первой и последней колонке, средние колонки пустые
+    static std::unique_ptr<Board> make_sample_board(const std::string& name,
+                                                    std::initializer_list<const char*> columns = {"Backlog", "Done"}) {
+        auto board = std::make_unique<Board>(name);
+        for (const char* column : columns) {
+            board->add_column(std::make_unique<Column>(column));
+        }
+        board->add_developer(std::make_unique<Developer>("Alice"));
+        board->add_developer(std::make_unique<Developer>("Bob"));
+
+        Column* first = board->get_columns().front().get();
+        Column* last = board->get_columns().back().get();
+        auto task1 = std::make_unique<Task>("Task \"quoted\"");
+        task1->set_description("Line one\nLine two");
+        task1->set_priority(5);
+        task1->set_developer(board->find_developer("Alice"));
+        first->add_task(std::move(task1));
+        first->add_task(std::make_unique<Task>("Task 2"));
+        auto task3 = std::make_unique<Task>("Task 3");
+        task3->set_developer(board->find_developer("Bob"));
+        last->add_task(std::move(task3));
+        return board;
+    }
+
+    std::filesystem::path dir;
+};
@@ -0,0 +1,96 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <unordered_set>
+#include "id_allocator.h"
+#include "task.h"
+
+// Test fixture для тестирования IdAllocator
+class IdAllocatorTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // Общий реестр очищается перед каждым тестом для изоляции
+        IdAllocator::instance().clear();
+        IdAllocator::instance().clear_seed();
+    }
+
+    void TearDown() override {
+        IdAllocator::instance().clear_seed();
+    }
+};
+
+// Тест выделения уникальных ID
+TEST_F(IdAllocatorTest, AllocateUnique) {
+    auto& allocator = IdAllocator::instance();
+    std::unordered_set<TaskId> seen;
+
+    for (int i = 0; i < 10000; ++i) {
+        TaskId id = allocator.allocate();
+        EXPECT_EQ(id.to_string().length(), IdAllocator::default_length);  // Длина по умолчанию
+        EXPECT_TRUE(seen.insert(id).second);                   // ID не повторяется
+    }
+    EXPECT_EQ(allocator.size(), 10000);
+}
+
+// Тест освобождения ID
+TEST_F(IdAllocatorTest, ReleaseAndReserve) {
+    auto& allocator = IdAllocator::instance();
+
+    TaskId id = TaskId::from_string("abc123");
+
+    allocator.reserve(id);
+    EXPECT_TRUE(allocator.contains(id));
+
+    // ID с двумя владельцами освобождается только после второго release
+    allocator.reserve(id);
+    allocator.release(id);
+    EXPECT_TRUE(allocator.contains(id));
+    allocator.release(id);
+    EXPECT_FALSE(allocator.contains(id));
+
+    // Освобождение неизвестного ID ничего не делает
+    allocator.release(TaskId::from_string("unknown"));
+    EXPECT_EQ(allocator.size(), 0);
+}
+
+// Тест воспроизводимости при фиксированном зерне
+TEST_F(IdAllocatorTest, DeterministicSeed) {
+    auto& allocator = IdAllocator::instance();
+
+    allocator.set_seed(42);
+    TaskId first = allocator.allocate();
+    TaskId second = allocator.allocate();
+
+    allocator.clear();
+    allocator.set_seed(42);
+    EXPECT_EQ(allocator.allocate(), first);
+    EXPECT_EQ(allocator.allocate(), second);
+}
+
+// Тест жизненного цикла ID вместе с задачей
+TEST_F(IdAllocatorTest, TaskOwnsId) {
+    auto& allocator = IdAllocator::instance();
+    TaskId id;
+    {
+        Task task("Task");
+        id = task.get_task_id();
+        EXPECT_TRUE(allocator.contains(id));
+
+        // При перемещении ID переходит к новой задаче и не освобождается
+        Task moved(std::move(task));
+        EXPECT_EQ(moved.get_task_id(), id);
+        EXPECT_TRUE(allocator.contains(id));
+    }
+    // После уничтожения задачи ID свободен
+    EXPECT_FALSE(allocator.contains(id));
+}
+
+// Тест ручной установки ID задачи
+TEST_F(IdAllocatorTest, SetIdUpdatesRegistry) {
+    auto& allocator = IdAllocator::instance();
+    Task task("Task");
+    TaskId generated = task.get_task_id();
+
+    task.set_id("loaded");
+    EXPECT_TRUE(allocator.contains(TaskId::from_string("loaded")));  // Новый ID зарегистрирован
+    EXPECT_FALSE(allocator.contains(generated));  // Старый ID освобожден
+}
@@ -0,0 +1,374 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <filesystem>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "board.h"
+#include "column.h"
+#include "developer.h"
+#include "json_worker.h"
+#include "board_loader.h"
+#include "task.h"
+#include "test_files.h"
+
+// Test fixture для тестирования сохранения и загрузки доски
+class JsonWorkerTest : public FileTest {
+protected:
+    void SetUp() override {
+        FileTest::SetUp();
+        board = make_sample_board("Test Board");
+    }
+
+    std::unique_ptr<Board> board;
+};
+
+// Потоковое сохранение совпадает с сохранением через DOM байт в байт
+TEST_F(JsonWorkerTest, StreamingSaveMatchesDom) {
+    std::vector<TaskId> ids;
+    for (const auto& column : board->get_columns()) {
+        for (const auto& task : column->get_tasks()) {
+            ids.push_back(task->get_task_id());
+        }
+    }
+    Json_worker dom_worker(path("dom.json"));
+    dom_worker.board_add(*board, dom_worker.ids_add(ids));
+    dom_worker.save();
+
+    Json_worker stream_worker(path("stream.json"));
+    stream_worker.board_save(*board);
+
+    EXPECT_EQ(read_file(path("dom.json")), read_file(path("stream.json")));
+}
+
+// Сохранение и загрузка восстанавливают все поля задач в обоих режимах чтения
+TEST_F(JsonWorkerTest, SaveLoadRoundTrip) {
+    for (LoadMode mode : {LoadMode::Stream, LoadMode::Mapped})
+    for (bool pretty : {true, false}) {
+        Json_worker writer(path("board.json"));
+        writer.board_save(*board, pretty);
+
+        Board loaded("Loaded");
+        Json_worker reader(path("board.json"));
+        reader.set_load_mode(mode);
+        reader.board_load(loaded);
+
+        ASSERT_EQ(loaded.get_columns().size(), 2);
+        ASSERT_EQ(loaded.get_developers().size(), 2);
+        EXPECT_EQ(reader.ids_get().size(), 3);
+
+        Column* backlog = loaded.find_column("Backlog");
+        ASSERT_NE(backlog, nullptr);
+        Task* task1 = backlog->find_task("Task \"quoted\"");
+        ASSERT_NE(task1, nullptr);
+        Task* original = board->find_column("Backlog")->find_task("Task \"quoted\"");
+        EXPECT_EQ(task1->get_task_id(), original->get_task_id());
+        EXPECT_EQ(task1->get_description(), "Line one\nLine two");
+        EXPECT_EQ(task1->get_priority(), 5);
+        EXPECT_EQ(task1->get_developer(), loaded.find_developer("Alice"));
+        EXPECT_EQ(backlog->find_task("Task 2")->get_developer(), nullptr);
+
+        // Загруженные задачи проиндексированы доской
+        EXPECT_EQ(loaded.find_task(original->get_task_id()), task1);
+        EXPECT_EQ(loaded.get_developer_tasks(loaded.find_developer("Bob")).size(), 1);
+    }
+}
+
+// Разработчики, записанные после колонок, назначаются после разбора
+TEST_F(JsonWorkerTest, LoadDevelopersAfterColumns) {
+    write_file(path("late.json"),
+        "{\"Board\": {\"Backlog\": {\"Task\": {\"developer\": \"Carol\", \"priority\": 2, \"id\": \"Late01\"}},"
+        " \"developers\": [\"Carol\"], \"ids\": [\"Late01\", \"Late01\"]}}");
+
+    Board loaded("Loaded");
+    Json_worker reader(path("late.json"));
+    reader.board_load(loaded);
+
+    Task* task = loaded.find_column("Backlog")->find_task("Task");
+    ASSERT_NE(task, nullptr);
+    EXPECT_EQ(task->get_id(), "Late01");
+    EXPECT_EQ(task->get_priority(), 2);
+    EXPECT_EQ(task->get_developer(), loaded.find_developer("Carol"));
+}
+
+// Лишние поля и значения неожиданных типов пропускаются
+TEST_F(JsonWorkerTest, LoadSkipsUnknownValues) {
+    write_file(path("extra.json"),
+        "{\"Board\": {\"ids\": {\"not\": \"array\"}, \"developers\": [\"Dan\", 7, null],"
+        " \"Backlog\": {\"Task\": {\"tags\": [\"a\", {\"b\": 1}], \"priority\": \"high\", \"description\": \"Text\"},"
+        " \"Broken\": 5},"
+        " \"Empty\": 3},"
+        " \"Second\": {\"Ignored\": {}}}");
+
+    Board loaded("Loaded");
+    Json_worker reader(path("extra.json"));
+    reader.board_load(loaded);
+
+    ASSERT_EQ(loaded.get_developers().size(), 1);
+    ASSERT_EQ(loaded.get_columns().size(), 2);
+    EXPECT_NE(loaded.find_column("Empty"), nullptr);
+    EXPECT_EQ(loaded.find_column("Ignored"), nullptr);
+    Column* backlog = loaded.find_column("Backlog");
+    ASSERT_EQ(backlog->get_tasks().size(), 1);
+    EXPECT_EQ(backlog->find_task("Task")->get_description(), "Text");
+    EXPECT_EQ(backlog->find_task("Task")->get_priority(), -1);
+}
+
+// Ошибка в файле не меняет текущую доску
+TEST_F(JsonWorkerTest, InvalidFileKeepsBoard) {
+    write_file(path("broken.json"), "{\"Board\": {\"Backlog\": {\"Task\": {\"priority\": 1}");
+    Json_worker reader(path("broken.json"));
+    EXPECT_THROW(reader.board_load(*board), std::runtime_error);
+    reader.set_load_mode(LoadMode::Stream);
+    EXPECT_THROW(reader.board_load(*board), std::runtime_error);
+
+    Json_worker missing_reader(path("missing.json"));
+    EXPECT_THROW(missing_reader.board_load(*board), std::runtime_error);
+
+    write_file(path("priority.json"), "{\"Board\": {\"Backlog\": {\"Task\": {\"priority\": 42}}}}");
+    Json_worker priority_reader(path("priority.json"));
+    EXPECT_THROW(priority_reader.board_load(*board), std::invalid_argument);
+
+    write_file(path("empty.json"), "{}");
+    Json_worker empty_reader(path("empty.json"));
+    EXPECT_THROW(empty_reader.board_load(*board), std::runtime_error);
+
+    EXPECT_EQ(board->get_columns().size(), 2);
+    EXPECT_EQ(board->find_column("Backlog")->get_tasks().size(), 2);
+    EXPECT_EQ(board->find_column("Backlog")->find_task("Task \"quoted\"")->get_developer(), board->find_developer("Alice"));
+}
+
+// Ошибки структуры и синтаксиса указывают смещение в файле
+TEST_F(JsonWorkerTest, LoadErrorsCarryOffset) {
+    for (LoadMode mode : {LoadMode::Stream, LoadMode::Mapped}) {
+        // Незакрытый объект - ошибка синтаксиса в конце файла
+        const std::string truncated = "{\"Board\": {\"ids\": []";
+        write_file(path("truncated.json"), truncated);
+        Json_worker reader(path("truncated.json"));
+        reader.set_load_mode(mode);
+        try {
+            reader.board_load(*board);
+            FAIL() << "BoardLoadError expected";
+        } catch (const BoardLoadError& e) {
+            EXPECT_EQ(e.get_offset(), truncated.size());
+        }
+
+        // Данные доски не объект - разбор прерывается на значении
+        write_file(path("scalar.json"), "{\"Board\": 42}");
+        Json_worker scalar_reader(path("scalar.json"));
+        scalar_reader.set_load_mode(mode);
+        try {
+            scalar_reader.board_load(*board);
+            FAIL() << "BoardLoadError expected";
+        } catch (const BoardLoadError& e) {
+            EXPECT_GE(e.get_offset(), 10);
+            EXPECT_LE(e.get_offset(), 12);
+        }
+
+        // Доска без колонок с задачами, разработчиков и ids
+        write_file(path("hollow.json"), "{\"Board\": {\"Backlog\": {}}}");
+        Json_worker hollow_reader(path("hollow.json"));
+        hollow_reader.set_load_mode(mode);
+        EXPECT_THROW(hollow_reader.board_load(*board), BoardLoadError);
+        EXPECT_FALSE(hollow_reader.is_valid_board_file(path("hollow.json")));
+    }
+    EXPECT_EQ(board->find_column("Backlog")->get_tasks().size(), 2);
+}
+
+// Проверка файла и ID используют результат того же разбора
+TEST_F(JsonWorkerTest, LoadValidatesAndKeepsIds) {
+    Json_worker writer(path("board.json"));
+    writer.board_save(*board);
+    EXPECT_TRUE(writer.is_valid_board_file(path("board.json")));
+
+    Board loaded("Loaded");
+    Json_worker reader(path("board.json"));
+    reader.board_load(loaded);
+
+    // После загрузки ID берутся из памяти, файл больше не читается
+    std::filesystem::remove(path("board.json"));
+    EXPECT_EQ(reader.ids_get().size(), 3);
+    reader.clear_ids();
+    EXPECT_TRUE(reader.ids_get().empty());
+}
+
+// Повторная загрузка в доску с ареной заменяет арену целиком
+TEST_F(JsonWorkerTest, ReloadIntoArenaBoard) {
+    Json_worker writer(path("board.json"));
+    writer.board_save(*board);
+
+    Board loaded("Loaded");
+    loaded.enable_arena();
+    for (int i = 0; i < 2; ++i) {
+        Json_worker reader(path("board.json"));
+        reader.board_load(loaded);
+        // 3 задачи, 2 колонки и 2 разработчика
+        EXPECT_EQ(loaded.get_arena()->get_live_objects(), 7);
+    }
+    EXPECT_EQ(loaded.find_column("Done")->find_task("Task 3")->get_developer(), loaded.find_developer("Bob"));
+}
+
+// Повторное сохранение неизмененной доски ничего не пишет
+TEST_F(JsonWorkerTest, UnchangedBoardIsNotRewritten) {
+    Json_worker writer(path("board.json"));
+    EXPECT_TRUE(writer.board_save(*board));
+    write_file(path("board.json"), "marker");
+    EXPECT_FALSE(writer.board_save(*board));
+    EXPECT_EQ(read_file(path("board.json")), "marker");
+    
+    // Другой вид вывода, изменение доски или удаленный файл - запись заново
+    EXPECT_TRUE(writer.board_save(*board, false));
+    board->find_column("Done")->find_task("Task 3")->set_priority(7);
+    EXPECT_TRUE(writer.board_save(*board, false));
+    std::filesystem::remove(path("board.json"));
+    EXPECT_TRUE(writer.board_save(*board, false));
+    EXPECT_TRUE(std::filesystem::exists(path("board.json")));
+}
+
+// Кеш колонок дает те же байты, что и полное кодирование, после любых изменений
+TEST_F(JsonWorkerTest, ColumnCacheMatchesFullSave) {
+    for (bool pretty : {true, false}) {
+        SetUp();
+        Json_worker cached(path("cached.json"));
+        cached.set_column_cache(true);
+        Json_worker full(path("full.json"));
+        auto check = [&]() {
+            cached.board_save(*board, pretty);
+            full.board_save(*board, pretty);
+            EXPECT_EQ(read_file(path("cached.json")), read_file(path("full.json")));
+        };
+        check();
+        
+        Column* backlog = board->find_column("Backlog");
+        Column* done = board->find_column("Done");
+        backlog->find_task("Task 2")->set_description("Edited");
+        check();
+        move_task(backlog, done, backlog->find_task("Task 2"));
+        check();
+        board->find_developer("Bob")->set_name("Robert");
+        check();
+        board->delete_developer(board->find_developer("Alice"));
+        check();
+        board->add_column(std::make_unique<Column>("Review"));
+        check();
+        // Пустая колонка в середине и опустевшая колонка
+        move_task(done, backlog, done->find_task("Task 3"));
+        move_task(done, backlog, done->find_task("Task 2"));
+        check();
+    }
+}
+
+// Большая колонка для параллельного режима: делится на несколько частей
+static void fill_backlog(Board& board, int task_count) {
+    Column* backlog = board.find_column("Backlog");
+    for (int i = 0; i < task_count; ++i) {
+        auto task = std::make_unique<Task>("Bulk \"" + std::to_string(i) + "\"\té");
+        task->set_description("Bulk description " + std::to_string(i) + "\nwith a second line");
+        task->set_priority(i % 11);
+        if (i % 3 == 0) {
+            task->set_developer(board.find_developer(i % 2 ? "Alice" : "Bob"));
+        }
+        backlog->add_task(std::move(task));
+    }
+    board.add_column(std::make_unique<Column>("Empty"));
+}
+
+// Параллельное сохранение дает те же байты, что и последовательное
+TEST_F(JsonWorkerTest, ParallelSaveMatchesSequential) {
+    fill_backlog(*board, 20000);
+    for (bool pretty : {true, false}) {
+        Json_worker sequential(path("sequential.json"));
+        sequential.board_save(*board, pretty);
+        Json_worker parallel(path("parallel.json"));
+        parallel.set_threads(4);
+        parallel.board_save(*board, pretty);
+        EXPECT_TRUE(read_file(path("parallel.json")) == read_file(path("sequential.json")));
+
+        // С кешем колонок кодируются параллельно только измененные колонки
+        Json_worker cached(path("cached.json"));
+        cached.set_threads(4);
+        cached.set_column_cache(true);
+        cached.board_save(*board, pretty);
+        board->find_column("Done")->find_task("Task 3")->set_priority(pretty ? 2 : 3);
+        cached.board_save(*board, pretty);
+        sequential.board_save(*board, pretty);
+        EXPECT_TRUE(read_file(path("cached.json")) == read_file(path("sequential.json")));
+    }
+}
+
+// Параллельная загрузка строит ту же доску, в том числе в арене
+TEST_F(JsonWorkerTest, ParallelLoadMatchesSequential) {
+    fill_backlog(*board, 20000);
+    for (bool pretty : {true, false}) {
+        Json_worker writer(path("board.json"));
+        writer.board_save(*board, pretty);
+
+        Board sequential("Loaded");
+        sequential.enable_arena();
+        Json_worker sequential_reader(path("board.json"));
+        sequential_reader.board_load(sequential);
+
+        Board parallel("Loaded");
+        parallel.enable_arena();
+        Json_worker parallel_reader(path("board.json"));
+        parallel_reader.set_threads(4);
+        parallel_reader.board_load(parallel);
+
+        Json_worker(path("sequential.json")).board_save(sequential, pretty);
+        Json_worker(path("parallel.json")).board_save(parallel, pretty);
+        // Большие строки сравниваются без вывода разницы
+        EXPECT_TRUE(read_file(path("parallel.json")) == read_file(path("sequential.json")));
+        EXPECT_EQ(parallel_reader.ids_get(), sequential_reader.ids_get());
+        EXPECT_EQ(parallel.get_arena()->get_live_objects(), sequential.get_arena()->get_live_objects());
+        EXPECT_EQ(parallel.get_developer_tasks(parallel.find_developer("Alice")).size(),
+                  sequential.get_developer_tasks(sequential.find_developer("Alice")).size());
+    }
+}
+
+// Необычные и поврежденные файлы загружаются (или отвергаются) так же, как последовательно
+TEST_F(JsonWorkerTest, ParallelLoadMatchesSequentialErrors) {
+    auto outcome = [&](const std::string& file, unsigned threads) -> std::string {
+        Board loaded("Loaded");
+        Json_worker reader(path(file));
+        reader.set_threads(threads);
+        try {
+            reader.board_load(loaded);
+        } catch (const std::exception& e) {
+            return std::string("error: ") + e.what();
+        }
+        Json_worker(path("dump.json")).board_save(loaded);
+        return read_file(path("dump.json"));
+    };
+
+    fill_backlog(*board, 20000);
+    Json_worker(path("big.json")).board_save(*board);
+    const std::string big = read_file(path("big.json"));
+    // Ошибка синтаксиса и неверный приоритет в середине большой колонки
+    std::string syntax = big;
+    syntax.insert(big.find("Bulk \\\"15000\\\"") - 1, "?");
+    write_file(path("syntax.json"), syntax);
+    std::string priority = big;
+    std::size_t at = big.find("\"priority\": ", big.find("Bulk \\\"12000\\\""));
+    priority.replace(at, std::string("\"priority\": 1").size(), "\"priority\": 99");
+    write_file(path("priority.json"), priority);
+
+    write_file(path("unusual.json"),
+        "{\"Board\": {\"ids\": {\"not\": \"array\"}, \"Backlog\": {\"Task\": {\"id\": \"Aa0001\", \"developer\": \"Dan\","
+        " \"tags\": [\"}\", {\"b\": \"\\\"]\"}]}, \"Second\": {\"id\": \"Bb0002\", \"priority\": 3}},"
+        " \"Empty\": null, \"ids\": [\"a1\"], \"developers\": [\"Dan\"], \"d\\u0065velopers\": [\"Eve\"]},"
+        " \"Other\": {\"Ignored\": {}}}");
+    write_file(path("hollow.json"), "{\"Board\": {\"Backlog\": {}, \"Done\": { }}}");
+    write_file(path("trailing.json"), "{\"Board\": {\"Backlog\": {\"Task\": {\"id\": \"Cc0003\"}}}} x");
+    write_file(path("empty.json"), "");
+
+    for (const char* file : {"big.json", "syntax.json", "priority.json", "unusual.json", "hollow.json",
+                             "trailing.json", "empty.json"}) {
+        SCOPED_TRACE(file);
+        std::string parallel = outcome(file, 4);
+        std::string sequential = outcome(file, 1);
+        EXPECT_TRUE(parallel == sequential) << parallel.substr(0, 200) << "\n" << sequential.substr(0, 200);
+    }
+    EXPECT_EQ(outcome("syntax.json", 4).rfind("error: ", 0), 0u);
+    EXPECT_EQ(outcome("unusual.json", 4).find("error"), std::string::npos);
+}
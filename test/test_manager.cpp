@@ -27,7 +27,7 @@ TEST_F(ManagerTest, CreateTask) {
     // Проверка что задача создана в правильной колонке
     auto& columns = board->get_columns();
     EXPECT_EQ(columns[0]->get_tasks().size(), 1);              // В колонке 1 задача
-    EXPECT_EQ(columns[0]->get_tasks()[0]->get_title(), "New Task");  // Заголовок правильный
+    EXPECT_EQ(columns[0]->get_tasks().nth(0)->get_title(), "New Task");  // Заголовок правильный
     
     // Тест создания задачи в несуществующей колонке - должно вызывать исключение
     EXPECT_THROW(create_task(*board, "NonExistent", "Task"), std::runtime_error);
@@ -75,9 +75,9 @@ TEST_F(ManagerTest, MultipleTasksAndDevelopers) {
     EXPECT_EQ(developers.size(), 3);  // 3 разработчика
     
     // Проверка заголовков задач
-    EXPECT_EQ(columns[0]->get_tasks()[0]->get_title(), "Task 1");
-    EXPECT_EQ(columns[1]->get_tasks()[0]->get_title(), "Task 2");
-    EXPECT_EQ(columns[2]->get_tasks()[0]->get_title(), "Task 3");
+    EXPECT_EQ(columns[0]->get_tasks().nth(0)->get_title(), "Task 1");
+    EXPECT_EQ(columns[1]->get_tasks().nth(0)->get_title(), "Task 2");
+    EXPECT_EQ(columns[2]->get_tasks().nth(0)->get_title(), "Task 3");
     
     // Проверка имен разработчиков
     EXPECT_EQ(developers[0]->get_name(), "Alice");
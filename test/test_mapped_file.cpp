@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <unistd.h>
+#include "mapped_file.h"
+
+// Test fixture с временным файлом
+class MappedFileTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        file_path = (std::filesystem::temp_directory_path() /
+                     ("scrum_board_mapped_test_" + std::to_string(::getpid()) + ".json")).string();
+    }
+
+    void TearDown() override {
+        std::filesystem::remove(file_path);
+    }
+
+    void write_file(const std::string& text) {
+        std::ofstream file(file_path, std::ios::binary);
+        file << text;
+    }
+
+    std::string file_path;
+};
+
+// Содержимое файла доступно целиком и завершено нулем
+TEST_F(MappedFileTest, ReadsContent) {
+    write_file("{\"Board\": {}}");
+    MappedFile file(file_path);
+    EXPECT_TRUE(file.is_mapped());
+    ASSERT_EQ(file.size(), 13);
+    EXPECT_EQ(std::string(file.data(), file.size()), "{\"Board\": {}}");
+    EXPECT_EQ(file.data()[file.size()], '\0');
+}
+
+// Нуль после данных есть и при размере файла, кратном странице
+TEST_F(MappedFileTest, PageSizedFileIsTerminated) {
+    long page = ::sysconf(_SC_PAGESIZE);
+    write_file(std::string(static_cast<std::size_t>(page) * 2, 'x'));
+    MappedFile file(file_path);
+    ASSERT_EQ(file.size(), static_cast<std::size_t>(page) * 2);
+    EXPECT_EQ(file.data()[file.size() - 1], 'x');
+    EXPECT_EQ(file.data()[file.size()], '\0');
+}
+
+// Запись в буфер не меняет файл на диске
+TEST_F(MappedFileTest, WritesStayPrivate) {
+    write_file("abcdef");
+    {
+        MappedFile file(file_path);
+        std::memcpy(file.data(), "XYZ", 3);
+        EXPECT_EQ(std::string(file.data(), file.size()), "XYZdef");
+    }
+    MappedFile file(file_path);
+    EXPECT_EQ(std::string(file.data(), file.size()), "abcdef");
+}
+
+// Пустой файл читается без отображения, отсутствующий - ошибка
+TEST_F(MappedFileTest, EmptyAndMissingFiles) {
+    write_file("");
+    MappedFile file(file_path);
+    EXPECT_FALSE(file.is_mapped());
+    EXPECT_EQ(file.size(), 0);
+    EXPECT_EQ(file.data()[0], '\0');
+
+    EXPECT_THROW(MappedFile(file_path + ".missing"), std::runtime_error);
+}
+
+// После возврата страниц данные снова читаются из файла
+TEST_F(MappedFileTest, ReleasedPagesAreReread) {
+    write_file(std::string(10000, 'x') + "end");
+    MappedFile file(file_path);
+    EXPECT_EQ(file.data()[0], 'x');
+    file.release_pages();
+    EXPECT_EQ(std::string(file.data() + 10000, file.size() - 10000), "end");
+    EXPECT_EQ(file.data()[file.size()], '\0');
+}
@@ -1,5 +1,8 @@
 #include <gtest/gtest.h>
 #include <memory>
+#include <stdexcept>
+#include <utility>
+#include "column.h"
 #include "task.h"
 #include "developer.h"
 
@@ -131,4 +134,26 @@ TEST_F(TaskTest, TaskEquality) {
     
     // Задачи все еще не равны из-за разных заголовков
     EXPECT_FALSE(*task1 == *task3);
-}
\ No newline at end of file
+}
+
+// Тест перемещения: свободная задача передает ID, задачу из колонки перемещать нельзя
+TEST_F(TaskTest, MoveKeepsColumnIndexes) {
+    Task loose("Loose");
+    std::string id = loose.get_id();
+    Task moved(std::move(loose));
+    EXPECT_EQ(moved.get_title(), "Loose");
+    EXPECT_EQ(moved.get_id(), id);
+    EXPECT_FALSE(loose.get_task_id().valid());
+
+    Column column("Backlog");
+    column.add_task(std::make_unique<Task>("Listed"));
+    Task* listed = column.find_task("Listed");
+    EXPECT_THROW(Task stolen(std::move(*listed)), std::logic_error);
+    EXPECT_THROW(*listed = std::move(moved), std::logic_error);
+    EXPECT_THROW(moved = std::move(*listed), std::logic_error);
+
+    // Задачи и индекс колонки не изменились
+    EXPECT_EQ(moved.get_title(), "Loose");
+    EXPECT_EQ(listed->get_title(), "Listed");
+    EXPECT_EQ(column.find_task("Listed"), listed);
+}
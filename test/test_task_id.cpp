@@ -0,0 +1,55 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <unordered_set>
+#include "task_id.h"
+#include "task.h"
+
+// Тест упаковки и распаковки ID base62
+TEST(TaskIdTest, Base62RoundTrip) {
+    // Типичный ID задачи из сохраненной доски
+    TaskId id = TaskId::from_string("aZ09xY");
+    EXPECT_TRUE(id.valid());
+    EXPECT_EQ(id.to_string(), "aZ09xY");
+
+    // Ведущие нули сохраняются благодаря записанной длине
+    EXPECT_EQ(TaskId::from_string("000042").to_string(), "000042");
+    EXPECT_NE(TaskId::from_string("42"), TaskId::from_string("000042"));
+
+    // Максимальная упаковываемая длина - 10 символов
+    EXPECT_EQ(TaskId::from_string("zzzzzzzzzz").to_string(), "zzzzzzzzzz");
+}
+
+// Тест ID, которые нельзя упаковать в число
+TEST(TaskIdTest, ForeignIdRoundTrip) {
+    TaskId custom = TaskId::from_string("custom_id_123");
+    EXPECT_TRUE(custom.valid());
+    EXPECT_EQ(custom.to_string(), "custom_id_123");
+
+    // Одинаковые строки дают одинаковые значения
+    EXPECT_EQ(TaskId::from_string("custom_id_123"), custom);
+    EXPECT_NE(TaskId::from_string("custom_id_124"), custom);
+}
+
+// Тест пустого ID
+TEST(TaskIdTest, EmptyId) {
+    TaskId empty = TaskId::from_string("");
+    EXPECT_FALSE(empty.valid());
+    EXPECT_EQ(empty.to_string(), "");
+    EXPECT_EQ(empty, TaskId());
+}
+
+// Тест хеширования упакованных ID
+TEST(TaskIdTest, Hashing) {
+    std::unordered_set<TaskId> ids;
+    ids.insert(TaskId::from_string("abc123"));
+    ids.insert(TaskId::from_string("abc123"));
+    ids.insert(TaskId::from_string("abc124"));
+    EXPECT_EQ(ids.size(), 2);
+}
+
+// Тест восстановления задачи с известным ID
+TEST(TaskIdTest, TaskRestoredId) {
+    Task task("Loaded Task", TaskId::from_string("Qw3rTy"));
+    EXPECT_EQ(task.get_id(), "Qw3rTy");
+    EXPECT_EQ(task.get_task_id(), TaskId::from_string("Qw3rTy"));
+}
@@ -0,0 +1,66 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <vector>
+#include "task_list.h"
+#include "task.h"
+
+// Test fixture для тестирования хранилища задач TaskList
+class TaskListTest : public ::testing::Test {
+protected:
+    // Заголовки задач в порядке обхода
+    std::vector<std::string> titles() const {
+        std::vector<std::string> result;
+        for (const auto& task : list) {
+            result.emplace_back(task->get_title());
+        }
+        return result;
+    }
+
+    TaskList list;
+};
+
+// Тест сохранения порядка добавления
+TEST_F(TaskListTest, PushBackKeepsOrder) {
+    list.push_back(std::make_unique<Task>("A"));
+    list.push_back(std::make_unique<Task>("B"));
+    list.push_back(std::make_unique<Task>("C"));
+    
+    EXPECT_EQ(list.size(), 3);
+    EXPECT_EQ(titles(), (std::vector<std::string>{"A", "B", "C"}));
+    EXPECT_EQ(list.nth(1)->get_title(), "B");
+    EXPECT_EQ(list.front()->get_title(), "A");
+    EXPECT_EQ(list.back()->get_title(), "C");
+}
+
+// Тест удаления из середины, начала и конца
+TEST_F(TaskListTest, RemoveKeepsOrder) {
+    uint32_t a = list.push_back(std::make_unique<Task>("A"));
+    uint32_t b = list.push_back(std::make_unique<Task>("B"));
+    uint32_t c = list.push_back(std::make_unique<Task>("C"));
+    
+    auto removed = list.remove(b);
+    EXPECT_EQ(removed->get_title(), "B");
+    EXPECT_EQ(titles(), (std::vector<std::string>{"A", "C"}));
+    
+    list.remove(a);
+    list.remove(c);
+    EXPECT_TRUE(list.empty());
+    EXPECT_TRUE(list.begin() == list.end());
+    
+    // Повторное удаление из пустого слота - ошибка
+    EXPECT_THROW(list.remove(b), std::out_of_range);
+}
+
+// Тест повторного использования освободившихся слотов
+TEST_F(TaskListTest, SlotsAreReused) {
+    uint32_t a = list.push_back(std::make_unique<Task>("A"));
+    list.push_back(std::make_unique<Task>("B"));
+    list.remove(a);
+    
+    // Новый элемент занимает освободившийся слот, но в порядке обхода идет последним
+    uint32_t c = list.push_back(std::make_unique<Task>("C"));
+    EXPECT_EQ(c, a);
+    EXPECT_EQ(titles(), (std::vector<std::string>{"B", "C"}));
+    EXPECT_EQ(list.at_slot(c)->get_title(), "C");
+}